@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+
+"""
+Benchmark solutions on the generated testcases.
+
+Each solution runs on each case several times and the resource usage of the
+process is taken from wait4(2): CPU time, max RSS, page faults and context
+switches. The report (JSON or CSV) can be compared with a report of another
+commit by --baseline.
+
+Note that on Linux max RSS is at least the RSS of this Python process, the
+kernel counts the memory of the forked process before exec. Small values
+are not meaningful, but they are comparable between reports.
+"""
+
+import sys
+import argparse
+import csv
+import json
+import os
+import platform
+import statistics
+import threading
+import time
+from logging import getLogger
+from pathlib import Path
+from subprocess import DEVNULL, PIPE, Popen, run
+from typing import Any, Dict, List, MutableMapping, Optional, Tuple
+
+from generate import (Problem, casename, compile_command, compiler_version,
+                      execcmd, find_problem_dir, setup_logging)
+
+logger = getLogger(__name__)
+
+REPORT_VERSION = 1
+
+# columns of a record, in the order of CSV
+FIELDS = [
+    'problem',
+    'solution',
+    'case',
+    'status',
+    'cpu_time',  # secs, min over runs
+    'cpu_time_median',  # secs
+    'wall_time',  # secs, min over runs
+    'max_rss',  # KiB, max over runs
+    'minor_faults',  # median over runs
+    'major_faults',
+    'voluntary_switches',
+    'involuntary_switches',
+]
+
+
+def measure(command: List[str], inpath: Path, timeout: float) -> Dict[str, Any]:
+    """run command once with stdin = inpath and return its resource usage"""
+    with open(inpath, 'rb') as infile:
+        start = time.perf_counter()
+        proc = Popen(command, stdin=infile, stdout=DEVNULL)
+        timer = threading.Timer(timeout, proc.kill)
+        timer.start()
+        try:
+            # unlike getrusage(RUSAGE_CHILDREN), wait4 reports this child only
+            _, status, usage = os.wait4(proc.pid, 0)
+        finally:
+            timer.cancel()
+        wall_time = time.perf_counter() - start
+    # the process is already reaped, don't let Popen wait for it again
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode < 0 and wall_time >= timeout:
+        result = 'TLE'
+    elif proc.returncode == 0:
+        result = 'OK'
+    else:
+        result = 'RE'
+    # ru_maxrss is in bytes on macOS, in KiB on Linux
+    max_rss = usage.ru_maxrss // 1024 if platform.system() == 'Darwin' else usage.ru_maxrss
+    return {
+        'status': result,
+        'cpu_time': usage.ru_utime + usage.ru_stime,
+        'wall_time': wall_time,
+        'max_rss': max_rss,
+        'minor_faults': usage.ru_minflt,
+        'major_faults': usage.ru_majflt,
+        'voluntary_switches': usage.ru_nvcsw,
+        'involuntary_switches': usage.ru_nivcsw,
+    }
+
+
+def summarize(runs: List[Dict[str, Any]]) -> Dict[str, Any]:
+    """merge the results of repeated runs of one case"""
+    statuses = [r['status'] for r in runs if r['status'] != 'OK']
+    cpu_times = [r['cpu_time'] for r in runs]
+    record = {
+        'status': statuses[0] if statuses else 'OK',
+        'cpu_time': round(min(cpu_times), 6),
+        'cpu_time_median': round(statistics.median(cpu_times), 6),
+        'wall_time': round(min(r['wall_time'] for r in runs), 6),
+        'max_rss': max(r['max_rss'] for r in runs),
+    }
+    for key in ['minor_faults', 'major_faults', 'voluntary_switches', 'involuntary_switches']:
+        record[key] = int(statistics.median(r[key] for r in runs))
+    return record
+
+
+def benchmark_problem(problem: Problem, solutions: List[str], repeat: int) -> List[Dict[str, Any]]:
+    # make sure that the testcases are generated and match hash.json
+    problem.generate(Problem.Mode.DEFAULT)
+
+    records: List[Dict[str, Any]] = []
+    cases = [casename(name, i) for name, i in problem.list_cases()]
+    for solution in solutions:
+        src = problem.basedir / 'sol' / solution
+        if not src.exists():
+            raise RuntimeError('Cannot find solution: {}'.format(src))
+        # build it like generate.py does, with the grader for function = true
+        sol = next((sol for sol in problem.config.get('solutions', [])
+                    if sol['name'] == solution), {'name': solution})
+        problem.compile_solution(sol)
+        logger.info('Benchmark {} : {}'.format(problem.basedir.name, solution))
+        total = 0.0
+        for case in cases:
+            inpath = problem.basedir / 'in' / (case + '.in')
+            runs = [measure(execcmd(src), inpath, problem.config['timelimit'])
+                    for _ in range(repeat)]
+            record = {'problem': problem.basedir.name, 'solution': solution, 'case': case}
+            record.update(summarize(runs))
+            total += record['cpu_time']
+            logger.info('{:>3s} {:6d} msecs {:8d} KiB : {}'.format(
+                record['status'], int(record['cpu_time'] * 1000), record['max_rss'], case))
+            records.append(record)
+        logger.info('total {} msecs : {} : {}'.format(
+            int(total * 1000), problem.basedir.name, solution))
+    return records
+
+
+def git_revision(rootdir: Path) -> Optional[str]:
+    proc = run(['git', 'describe', '--always', '--dirty'], cwd=str(rootdir),
+               stdout=PIPE, stderr=DEVNULL)
+    if proc.returncode:
+        return None
+    return proc.stdout.decode().strip()
+
+
+def write_report(path: Path, report: MutableMapping[str, Any]):
+    if path.suffix == '.csv':
+        with open(path, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=FIELDS)
+            writer.writeheader()
+            writer.writerows(report['results'])
+    else:
+        with open(path, 'w') as f:
+            json.dump(report, f, indent=2)
+            f.write('\n')
+
+
+def read_results(path: Path) -> List[Dict[str, Any]]:
+    if path.suffix == '.csv':
+        with open(path, newline='') as f:
+            results: List[Dict[str, Any]] = list(csv.DictReader(f))
+        for r in results:
+            for key in ['cpu_time', 'cpu_time_median', 'wall_time']:
+                r[key] = float(r[key])
+            for key in FIELDS[7:]:
+                r[key] = int(r[key])
+        return results
+    with open(path) as f:
+        report = json.load(f)
+    if report.get('version') != REPORT_VERSION:
+        raise RuntimeError('Unknown report version: {}'.format(path))
+    return report['results']
+
+
+def compare(baseline: List[Dict[str, Any]], results: List[Dict[str, Any]],
+            threshold: float, min_time: float, min_rss: int) -> List[str]:
+    """
+    list regressions from baseline, cases only in one side are ignored.
+    both of the ratio (threshold) and the absolute difference (min_time, min_rss)
+    must be exceeded, so noise of small cases is not reported.
+    """
+    def key(r: Dict[str, Any]) -> Tuple[str, str, str]:
+        return (r['problem'], r['solution'], r['case'])
+
+    base = {key(r): r for r in baseline}
+    regressions: List[str] = []
+    for r in results:
+        old = base.get(key(r))
+        if old is None:
+            continue
+        name = '{} : {} : {}'.format(*key(r))
+        if old['status'] == 'OK' and r['status'] != 'OK':
+            regressions.append('{} : status {} -> {}'.format(name, old['status'], r['status']))
+            continue
+        if r['cpu_time'] > old['cpu_time'] * (1 + threshold) and \
+                r['cpu_time'] - old['cpu_time'] >= min_time:
+            regressions.append('{} : cpu time {:.3f} -> {:.3f} secs'.format(
+                name, old['cpu_time'], r['cpu_time']))
+        if r['max_rss'] > old['max_rss'] * (1 + threshold) and \
+                r['max_rss'] - old['max_rss'] >= min_rss:
+            regressions.append('{} : max rss {} -> {} KiB'.format(
+                name, old['max_rss'], r['max_rss']))
+    return regressions
+
+
+def main(args: List[str]) -> int:
+    setup_logging()
+
+    parser = argparse.ArgumentParser(description='Solution Benchmark')
+    parser.add_argument('toml', nargs='*', help='Toml File')
+    parser.add_argument('-p', '--problem', nargs='*',
+                        help='Benchmark problem', default=[])
+    parser.add_argument('-s', '--solution', nargs='*', default=['correct.cpp'],
+                        help='Solutions in sol/ to benchmark (default: correct.cpp)')
+    parser.add_argument('-n', '--repeat', type=int, default=3,
+                        help='Number of runs of each case')
+    parser.add_argument('-o', '--output', type=Path,
+                        help='Report file (.json or .csv)')
+    parser.add_argument('--baseline', type=Path,
+                        help='Report to compare with, exit with 1 on regressions')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='Allowed relative increase of cpu time and max rss (default: 0.1)')
+    parser.add_argument('--min-time', type=float, default=0.01,
+                        help='Ignore cpu time increases smaller than this (secs, default: 0.01)')
+    parser.add_argument('--min-rss', type=int, default=1024,
+                        help='Ignore max rss increases smaller than this (KiB, default: 1024)')
+    opts = parser.parse_args(args)
+
+    if opts.repeat < 1:
+        raise ValueError('--repeat must be positive')
+    if not hasattr(os, 'wait4'):
+        raise RuntimeError('benchmark needs os.wait4, which is not available on {}'.format(
+            platform.system()))
+
+    rootdir: Path = Path(__file__).parent
+    problems: List[Problem] = list()
+    for tomlpath in opts.toml:
+        problems.append(Problem(rootdir, Path(tomlpath).parent))
+    for problem_name in opts.problem:
+        problem_dir = find_problem_dir(rootdir, problem_name)
+        if problem_dir is None:
+            raise ValueError('Cannot find problem: {}'.format(problem_name))
+        problems.append(Problem(rootdir, problem_dir))
+
+    if len(problems) == 0:
+        logger.warning('No problems')
+
+    # benchmark one process at a time, parallel runs disturb each other
+    results: List[Dict[str, Any]] = []
+    for problem in problems:
+        results.extend(benchmark_problem(problem, opts.solution, opts.repeat))
+
+    if opts.output is not None:
+        command = compile_command(rootdir)
+        write_report(opts.output, {
+            'version': REPORT_VERSION,
+            'revision': git_revision(rootdir),
+            'compiler': compiler_version(command[0]),
+            'command': command,
+            'platform': platform.platform(),
+            'repeat': opts.repeat,
+            'results': results,
+        })
+
+    if opts.baseline is not None:
+        regressions = compare(read_results(opts.baseline), results,
+                              opts.threshold, opts.min_time, opts.min_rss)
+        for message in regressions:
+            logger.error('regression: {}'.format(message))
+        if regressions:
+            return 1
+        logger.info('no regressions from {}'.format(opts.baseline))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace library_checker {
+
+// Bump allocator of T addressed by 32-bit indices.
+//
+// Objects are placement-constructed into chunks of 2^CHUNK_BITS elements
+// and are never freed or moved until the pool is destroyed, so a pointer
+// or reference to an element stays valid while more elements are made.
+// This fits persistent structures, whose nodes are shared by versions and
+// live until the end: no reference counts, no per-node malloc, and a link
+// is 4 bytes instead of 8.
+//
+// Index 0 is null and is never returned by make(). Pointer-based
+// structures can use make_ptr() instead, the pool then replaces a
+// preallocated `new Node[N]` and its memory grows with the nodes made.
+//
+// With huge_pages, chunks are aligned to 2 MiB, their size is rounded up
+// to a multiple of 2 MiB and madvise(MADV_HUGEPAGE) is requested for them,
+// which cuts TLB misses of random accesses to large pools. The kernel only
+// backs whole aligned 2 MiB ranges with huge pages, so a smaller chunk would
+// get none. It is only a hint: without transparent huge pages (or off Linux)
+// the chunks are ordinary memory.
+template <class T, int CHUNK_BITS = 16> struct Pool {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "elements are never destroyed one by one");
+    static_assert(0 < CHUNK_BITS && CHUNK_BITS < 32);
+
+    using Index = std::uint32_t;
+    static constexpr Index null = 0;
+    static constexpr Index CHUNK = Index(1) << CHUNK_BITS;
+
+    static constexpr std::size_t HUGE_PAGE = std::size_t(1) << 21;
+
+    Pool() = default;
+    explicit Pool(bool huge_pages_) : huge_pages(huge_pages_) {}
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+    ~Pool() {
+        for (T* chunk : chunks) ::operator delete(chunk, chunk_align());
+    }
+
+    template <class... Args> Index make(Args&&... args) {
+        if ((len >> CHUNK_BITS) == chunks.size()) add_chunk();
+        void* p = chunks[len >> CHUNK_BITS] + (len & (CHUNK - 1));
+        // aggregates are brace-initialized
+        if constexpr (std::is_constructible<T, Args&&...>::value) {
+            ::new (p) T(std::forward<Args>(args)...);
+        } else {
+            ::new (p) T{std::forward<Args>(args)...};
+        }
+        return len++;
+    }
+
+    template <class... Args> T* make_ptr(Args&&... args) {
+        return &(*this)[make(std::forward<Args>(args)...)];
+    }
+
+    T& operator[](Index i) {
+        assert(i != null && i < len);
+        return chunks[i >> CHUNK_BITS][i & (CHUNK - 1)];
+    }
+    const T& operator[](Index i) const {
+        assert(i != null && i < len);
+        return chunks[i >> CHUNK_BITS][i & (CHUNK - 1)];
+    }
+
+    // drops every element, the chunks are kept for the next ones
+    void clear() { len = 1; }
+
+    // number of indices handed out, including null
+    std::size_t size() const { return len; }
+    // bytes of the chunks
+    std::size_t capacity_bytes() const { return chunks.size() * chunk_bytes(); }
+
+  private:
+    bool huge_pages = false;
+    std::vector<T*> chunks;
+    // slot 0 of the first chunk is left unconstructed for null
+    Index len = 1;
+
+    std::align_val_t chunk_align() const {
+        return std::align_val_t(huge_pages ? HUGE_PAGE : alignof(T));
+    }
+
+    std::size_t chunk_bytes() const {
+        std::size_t bytes = sizeof(T) * CHUNK;
+        return huge_pages ? (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE : bytes;
+    }
+
+    void add_chunk() {
+        assert(chunks.size() < (std::size_t(1) << (32 - CHUNK_BITS)));
+        std::size_t bytes = chunk_bytes();
+        void* chunk = ::operator new(bytes, chunk_align());
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (huge_pages) madvise(chunk, bytes, MADV_HUGEPAGE);
+#endif
+        chunks.push_back(static_cast<T*>(chunk));
+    }
+};
+
+}  // namespace library_checker
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+
+namespace library_checker {
+
+// Maximum matching of a bipartite graph by Hopcroft-Karp, O(m sqrt(n)).
+//
+// Edge i = (l, r) joins left vertex l and right vertex r; multiple edges
+// are allowed. The left-to-right arcs are a CSRGraph, whose arc ids are
+// the edge ids, so the matched edges are known by id as well as by their
+// endpoints.
+//
+// - Karp-Sipser warm start: a vertex with a single unmatched neighbor is
+//   matched to it, which never makes the matching worse; when there is
+//   none, the first free left vertex is matched greedily. This is O(n + m)
+//   and on random inputs leaves only a few vertices to the phases.
+// - Each phase is a BFS from the free left vertices that labels the left
+//   vertices by layer, then an iterative DFS over the layered graph that
+//   keeps the next arc of each vertex across searches, like Dinic, and
+//   marks a vertex dead when its arcs run out.
+struct BipartiteMatching {
+    // right partner of each left vertex, and left partner of each right
+    // vertex, -1 if unmatched
+    std::vector<int> match_l, match_r;
+    // the edge id matching each left vertex, -1 if unmatched
+    std::vector<int> match_edge;
+
+    BipartiteMatching(int l_, int r_, const std::vector<std::pair<int, int>>& edges)
+        : match_l(l_, -1),
+          match_r(r_, -1),
+          match_edge(l_, -1),
+          l(l_),
+          r(r_),
+          g(CSRGraph::directed(std::max(l, r), edges)) {
+        greedy(edges);
+        while (bfs()) {
+            for (int u = 0; u < l; u++) {
+                if (match_l[u] == -1) augment(u);
+            }
+        }
+    }
+
+    int size() const { return matched; }
+
+    // (left, right) of the matched pairs, by the left vertex
+    std::vector<std::pair<int, int>> pairs() const {
+        std::vector<std::pair<int, int>> res;
+        res.reserve(matched);
+        for (int u = 0; u < l; u++) {
+            if (match_l[u] != -1) res.emplace_back(u, match_l[u]);
+        }
+        return res;
+    }
+
+  private:
+    static constexpr int DEAD = -1;
+
+    int l, r;
+    // the arcs l -> r; the graph has max(l, r) vertices so that both
+    // sides are in range, the ones >= l have no arcs
+    CSRGraph g;
+    int matched = 0;
+    // layer of each left vertex in the current phase, DEAD if it cannot
+    // reach a free right vertex through the layered graph
+    std::vector<int> layer;
+    // next arc of each left vertex in the current phase
+    std::vector<const CSRGraph::Arc*> next;
+    // the left vertices of the path being searched by augment()
+    std::vector<int> st;
+
+    void match(int u, const CSRGraph::Arc& a) {
+        match_l[u] = a.to;
+        match_r[a.to] = u;
+        match_edge[u] = a.id;
+    }
+
+    // Karp-Sipser. Vertices are 0..l-1 on the left and l..l+r-1 on the
+    // right; deg counts the arcs to unmatched vertices.
+    void greedy(const std::vector<std::pair<int, int>>& edges) {
+        std::vector<std::pair<int, int>> flipped(edges.size());
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            auto [a, b] = edges[i];
+            assert(0 <= a && a < l && 0 <= b && b < r);
+            flipped[i] = {b, a};
+        }
+        CSRGraph rev = CSRGraph::directed(std::max(l, r), flipped);
+        std::vector<int> deg(l + r);
+        st.clear();
+        for (int u = 0; u < l; u++) deg[u] = g[u].size();
+        for (int v = 0; v < r; v++) deg[l + v] = rev[v].size();
+        for (int x = 0; x < l + r; x++) {
+            if (deg[x] == 1) st.push_back(x);
+        }
+
+        auto is_free = [&](int x) { return x < l ? match_l[x] == -1 : match_r[x - l] == -1; };
+        // remove the matched vertex x from the degrees of its neighbors
+        auto remove = [&](int x) {
+            auto arcs = x < l ? g[x] : rev[x - l];
+            int off = x < l ? l : 0;
+            for (auto a : arcs) {
+                int y = off + a.to;
+                if (is_free(y) && --deg[y] == 1) st.push_back(y);
+            }
+        };
+        // match x with its first free neighbor, deg[x] > 0
+        auto take = [&](int x) {
+            auto arcs = x < l ? g[x] : rev[x - l];
+            for (auto a : arcs) {
+                if (x < l ? match_r[a.to] != -1 : match_l[a.to] != -1) continue;
+                if (x < l) {
+                    match(x, a);
+                } else {
+                    // the arc of the left vertex with the same edge id
+                    match(a.to, CSRGraph::Arc{x - l, a.id});
+                }
+                matched++;
+                int y = x < l ? l + a.to : a.to;
+                remove(x);
+                remove(y);
+                return;
+            }
+        };
+
+        int u = 0;
+        while (true) {
+            if (!st.empty()) {
+                int x = st.back();
+                st.pop_back();
+                if (is_free(x) && deg[x] == 1) take(x);
+                continue;
+            }
+            while (u < l && (match_l[u] != -1 || deg[u] == 0)) u++;
+            if (u == l) break;
+            take(u);
+        }
+    }
+
+    // layers from the free left vertices, up to the first layer that sees
+    // a free right vertex; false if there is no augmenting path
+    bool bfs() {
+        layer.assign(l, DEAD);
+        std::vector<int> que;
+        que.reserve(l);
+        for (int u = 0; u < l; u++) {
+            if (match_l[u] == -1) {
+                layer[u] = 0;
+                que.push_back(u);
+            }
+        }
+        // the layer of the shortest augmenting paths, once known
+        int last = l;
+        for (std::size_t i = 0; i < que.size(); i++) {
+            int u = que[i];
+            if (layer[u] > last) break;
+            for (auto a : g[u]) {
+                int w = match_r[a.to];
+                if (w == -1) {
+                    last = layer[u];
+                } else if (layer[w] == DEAD) {
+                    layer[w] = layer[u] + 1;
+                    que.push_back(w);
+                }
+            }
+        }
+        next.resize(l);
+        for (int u = 0; u < l; u++) next[u] = g[u].begin();
+        return last < l;
+    }
+
+    // an augmenting path from the free left vertex s along the layers,
+    // with an explicit stack of left vertices
+    void augment(int s) {
+        st.assign(1, s);
+        while (!st.empty()) {
+            int u = st.back();
+            if (next[u] == g[u].end()) {
+                layer[u] = DEAD;
+                st.pop_back();
+                if (!st.empty()) next[st.back()]++;
+                continue;
+            }
+            int w = match_r[next[u]->to];
+            if (w == -1) {
+                // flip the path, next[x] is the arc taken from each x on it
+                for (int x : st) match(x, *next[x]);
+                matched++;
+                return;
+            }
+            if (layer[w] == layer[u] + 1) {
+                st.push_back(w);
+            } else {
+                next[u]++;
+            }
+        }
+    }
+};
+
+}  // namespace library_checker
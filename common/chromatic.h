@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "cpu_features.h"
+
+namespace library_checker {
+
+// I[S] = the number of independent sets contained in S, the empty set
+// included, for every S of the n <= 30 vertices. adj[v] is the bitmask of
+// the neighbors of v; v is in adj[v] if v has a loop.
+//
+// This is the zeta transform of the indicator of independent sets, in
+// closed form: with v the lowest vertex of S, a set is either without v or
+// contains v and avoids its neighbors, I[S] = I[S - v] + I[S - N[v]].
+inline std::vector<std::uint32_t> independent_set_counts(int n,
+                                                         const std::vector<std::uint32_t>& adj) {
+    assert(0 <= n && n <= 30 && int(adj.size()) == n);
+    std::vector<std::uint32_t> cnt(std::size_t(1) << n);
+    cnt[0] = 1;
+    for (std::uint32_t s = 1; s < cnt.size(); s++) {
+        int v = __builtin_ctz(s);
+        std::uint32_t rest = s & (s - 1);
+        cnt[s] = cnt[rest];
+        if (!(adj[v] >> v & 1)) cnt[s] += cnt[rest & ~adj[v]];
+    }
+    return cnt;
+}
+
+// Number of k-tuples of independent sets whose union is V, by
+// inclusion-exclusion over the union:
+//
+//   c_k = sum_S (-1)^{n - |S|} I[S]^k.
+//
+// The sets may overlap, so c_k is not the number of colorings, but c_k > 0
+// iff G is k-colorable: remove the overlaps to get a coloring.
+//
+// I[S] <= 2^|S| takes few distinct values compared to 2^n, so the sum is
+// grouped by the value: coef[v] is the signed number of S with I[S] = v.
+// The terms coef[v] v^k are kept in an array that is multiplied by v
+// after each k, so c_0, c_1, ... cost one modular multiplication
+// and one addition per distinct value. Products are Montgomery reductions
+// modulo an odd MOD < 2^30, 8 lanes at a time with AVX2.
+struct IndependentCoverCounter {
+    IndependentCoverCounter(int n, const std::vector<std::uint32_t>& adj, std::uint32_t mod_)
+        : mod(mod_) {
+        assert(mod % 2 == 1 && mod < (1u << 30));
+        neg_inv = mod;
+        for (int i = 0; i < 5; i++) neg_inv *= 2 - mod * neg_inv;
+        neg_inv = -neg_inv;
+        std::uint64_t r = (std::uint64_t(1) << 32) % mod;
+
+        auto is = independent_set_counts(n, adj);
+        std::vector<std::int32_t> coef(is.size() + 1, 0);
+        for (std::uint32_t s = 0; s < is.size(); s++) {
+            coef[is[s]] += (n - __builtin_popcount(s)) % 2 ? -1 : 1;
+        }
+        for (std::uint32_t v = 0; v < coef.size(); v++) {
+            if (coef[v] == 0) continue;
+            // v in Montgomery form, coef[v] * v^0 in normal form
+            base.push_back(std::uint32_t(v * r % mod));
+            term.push_back(std::uint32_t((std::int64_t(coef[v]) % mod + mod) % mod));
+        }
+    }
+
+    // c_k mod MOD, for k = 0, 1, 2, ... one per call
+    std::uint32_t next() {
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::avx2)) return next_avx2();
+#endif
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < term.size(); i++) {
+            sum += term[i];
+            term[i] = reduce(std::uint64_t(term[i]) * base[i]);
+        }
+        return std::uint32_t(sum % mod);
+    }
+
+    // the number of distinct values of I[S] with a nonzero coefficient
+    int size() const { return int(term.size()); }
+
+  private:
+    std::uint32_t mod, neg_inv;
+    // in Montgomery form
+    std::vector<std::uint32_t> base;
+    // coef[v] v^k, in [0, 2 MOD)
+    std::vector<std::uint32_t> term;
+
+    // x * 2^{-32} mod MOD in [0, 2 MOD), x < MOD * 2^32
+    std::uint32_t reduce(std::uint64_t x) const {
+        std::uint32_t q = std::uint32_t(x) * neg_inv;
+        return std::uint32_t((x + std::uint64_t(q) * mod) >> 32);
+    }
+
+#if defined(LIBRARY_CHECKER_X86)
+    __attribute__((target("avx2"))) std::uint32_t next_avx2() {
+        const __m256i vmod = _mm256_set1_epi32(int(mod));
+        const __m256i vneg_inv = _mm256_set1_epi32(int(neg_inv));
+        const __m256i lo = _mm256_set1_epi64x(0xffffffff);
+        __m256i sum = _mm256_setzero_si256();
+        std::size_t n = term.size(), i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(term.data() + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base.data() + i));
+            // at most 2^20 terms below 2^31 per lane
+            sum = _mm256_add_epi64(sum, _mm256_and_si256(t, lo));
+            sum = _mm256_add_epi64(sum, _mm256_srli_epi64(t, 32));
+            // Montgomery reduction of even and odd lanes in 64 bits
+            __m256i pe = _mm256_mul_epu32(t, b);
+            __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(b, 32));
+            __m256i re = _mm256_add_epi64(pe, _mm256_mul_epu32(_mm256_mul_epu32(pe, vneg_inv), vmod));
+            __m256i ro = _mm256_add_epi64(po, _mm256_mul_epu32(_mm256_mul_epu32(po, vneg_inv), vmod));
+            t = _mm256_blend_epi32(_mm256_srli_epi64(re, 32), ro, 0b10101010);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(term.data() + i), t);
+        }
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sum);
+        std::uint64_t res = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        for (; i < n; i++) {
+            res += term[i];
+            term[i] = reduce(std::uint64_t(term[i]) * base[i]);
+        }
+        return std::uint32_t(res % mod);
+    }
+#endif
+};
+
+// The smallest k such that G has a proper k-coloring, 0 for n = 0.
+//
+// c_k is computed modulo a random prime in [2^29, 2^30). A nonzero
+// residue proves c_k > 0, and c_k = 0 exactly for k below the answer. So
+// only k = chi can go wrong, and c_chi <= 2^{n chi} has at most n^2 / 29
+// prime factors in that range: a wrong answer needs the prime to be one of
+// them, out of the ~2.6 * 10^7 candidates.
+inline int chromatic_number(int n, const std::vector<std::uint32_t>& adj) {
+    if (n == 0) return 0;
+    std::mt19937 rng(std::random_device{}());
+    auto is_prime = [](std::uint32_t p) {
+        for (std::uint32_t d = 2; d * d <= p; d++) {
+            if (p % d == 0) return false;
+        }
+        return true;
+    };
+    std::uint32_t p;
+    do {
+        p = (1u << 29) | (rng() & ((1u << 29) - 1)) | 1;
+    } while (!is_prime(p));
+
+    IndependentCoverCounter counter(n, adj, p);
+    counter.next();  // k = 0
+    for (int k = 1; k < n; k++) {
+        if (counter.next()) return k;
+    }
+    return n;
+}
+
+}  // namespace library_checker
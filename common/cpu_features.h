@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+
+// Kernels using x86 extensions are compiled with target attributes and
+// selected at runtime by cpu_supports(), so the default flags (no -mavx2,
+// no -mpopcnt) are enough. LIBRARY_CHECKER_X86 is defined where such
+// kernels can be compiled at all.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LIBRARY_CHECKER_X86
+#endif
+
+namespace library_checker {
+
+enum class CpuFeature : unsigned { avx2 = 1, popcnt = 2 };
+
+namespace internal {
+
+// the features turned off by the live DisableCpuFeature scopes
+inline std::atomic<unsigned>& disabled_cpu_features() {
+    static std::atomic<unsigned> mask{0};
+    return mask;
+}
+
+}  // namespace internal
+
+// Whether the kernels for f may run: the compiler can target f, the CPU
+// has it, and no DisableCpuFeature scope turned it off. The CPU is probed
+// once.
+inline bool cpu_supports(CpuFeature f) {
+#if defined(LIBRARY_CHECKER_X86)
+    static const unsigned detected =
+        (__builtin_cpu_supports("avx2") ? unsigned(CpuFeature::avx2) : 0u) |
+        (__builtin_cpu_supports("popcnt") ? unsigned(CpuFeature::popcnt) : 0u);
+    unsigned disabled = internal::disabled_cpu_features().load(std::memory_order_relaxed);
+    return detected & ~disabled & unsigned(f);
+#else
+    (void)f;
+    return false;
+#endif
+}
+
+// cpu_supports(f) is false while this is alive, so that the generic code
+// paths can be tested on machines with f. Scopes nest; the previous state
+// is restored on destruction.
+struct DisableCpuFeature {
+    explicit DisableCpuFeature(CpuFeature f)
+        : prev(internal::disabled_cpu_features().fetch_or(unsigned(f))) {}
+    ~DisableCpuFeature() { internal::disabled_cpu_features().store(prev); }
+    DisableCpuFeature(const DisableCpuFeature&) = delete;
+    DisableCpuFeature& operator=(const DisableCpuFeature&) = delete;
+
+  private:
+    unsigned prev;
+};
+
+}  // namespace library_checker
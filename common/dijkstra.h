@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+
+namespace library_checker {
+
+// Monotone priority queue of (key, value) with 64-bit unsigned keys.
+//
+// Every key pushed must be >= the last key popped. An entry goes to the
+// bucket of the highest bit in which its key differs from the last popped
+// key, 0 if equal. pop() takes from bucket 0; when it is empty, the first
+// nonempty bucket is scanned for its minimum, which becomes the last key,
+// and its entries move to strictly lower buckets. An entry moves at most 64
+// times, and a bitmask of the nonempty buckets finds the next one with a
+// ctz instead of a scan, which keeps the pop free of unpredictable loops.
+template <class V> struct RadixHeap {
+    using Key = std::uint64_t;
+
+    bool empty() const { return sz == 0; }
+    std::size_t size() const { return sz; }
+
+    void push(Key key, V val) {
+        assert(key >= last);
+        put({key, val});
+        sz++;
+    }
+
+    // the entry of the smallest key; ties in no particular order
+    std::pair<Key, V> pop() {
+        assert(sz);
+        if (buckets[0].empty()) {
+            int i = __builtin_ctzll(nonempty) + 1;
+            nonempty &= nonempty - 1;
+            auto& from = buckets[i];
+            Key m = from[0].first;
+            for (const auto& e : from) m = std::min(m, e.first);
+            last = m;
+            for (const auto& e : from) put(e);
+            from.clear();
+        }
+        auto e = buckets[0].back();
+        buckets[0].pop_back();
+        sz--;
+        return e;
+    }
+
+  private:
+    std::array<std::vector<std::pair<Key, V>>, 65> buckets;
+    // bit i - 1 is set iff buckets[i] is nonempty, for i >= 1
+    std::uint64_t nonempty = 0;
+    Key last = 0;
+    std::size_t sz = 0;
+
+    void put(const std::pair<Key, V>& e) {
+        if (e.first == last) {
+            buckets[0].push_back(e);
+            return;
+        }
+        int i = 64 - __builtin_clzll(e.first ^ last);
+        buckets[i].push_back(e);
+        nonempty |= std::uint64_t(1) << (i - 1);
+    }
+};
+
+// 4-ary min-heap over the ids 0..n-1, each in the heap at most once, with
+// decrease-key.
+//
+// The entries are (key, id) in the heap array and pos[id] is the index of
+// the entry, so the keys compared while sifting are read from the heap
+// array itself. With 4 children a level is one 64-byte line for 16-byte
+// entries and the heap is half as deep as a binary one.
+template <class K> struct IndexedQuaternaryHeap {
+    IndexedQuaternaryHeap() = default;
+    explicit IndexedQuaternaryHeap(int n) : pos(n, -1) {}
+
+    bool empty() const { return heap.empty(); }
+    int size() const { return int(heap.size()); }
+    bool contains(int id) const { return pos[id] >= 0; }
+
+    // insert id, or lower its key; a larger key than the current is ignored
+    void push_or_decrease(int id, K key) {
+        int i = pos[id];
+        if (i == -1) {
+            i = int(heap.size());
+            heap.emplace_back(key, id);
+        } else if (!(std::make_pair(key, id) < heap[i])) {
+            return;
+        }
+        sift_up(i, {key, id});
+    }
+
+    // the entry of the smallest (key, id)
+    std::pair<K, int> pop() {
+        assert(!heap.empty());
+        auto top = heap[0];
+        pos[top.second] = -1;
+        auto x = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) sift_down(0, x);
+        return top;
+    }
+
+  private:
+    std::vector<std::pair<K, int>> heap;
+    // index in heap, -1 if not in it
+    std::vector<int> pos;
+
+    void place(int i, const std::pair<K, int>& x) {
+        heap[i] = x;
+        pos[x.second] = i;
+    }
+    void sift_up(int i, std::pair<K, int> x) {
+        while (i) {
+            int p = (i - 1) / 4;
+            if (!(x < heap[p])) break;
+            place(i, heap[p]);
+            i = p;
+        }
+        place(i, x);
+    }
+    void sift_down(int i, std::pair<K, int> x) {
+        int n = int(heap.size());
+        while (true) {
+            int c = 4 * i + 1;
+            if (c >= n) break;
+            int best = c, end = std::min(c + 4, n);
+            for (int j = c + 1; j < end; j++) {
+                if (heap[j] < heap[best]) best = j;
+            }
+            if (!(heap[best] < x)) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, x);
+    }
+};
+
+// Single source shortest paths with nonnegative costs.
+//
+// The arcs of the CSRGraph are packed once with their costs into
+// {to, id, cost} records of 16 bytes, so relaxing a vertex reads one
+// contiguous range; the graph itself is not referenced afterwards. run()
+// takes the queue to use:
+//
+// - Heap::radix: RadixHeap with lazy deletion. Distances only grow, so the
+//   monotone queue applies; a push is an append, and the work per entry is
+//   the number of buckets it moves through.
+// - Heap::quaternary: IndexedQuaternaryHeap with decrease-key, so the heap
+//   holds at most n entries even when the graph is dense. The vertices are
+//   settled in the order of (distance, vertex), the same order as a
+//   priority_queue of (distance, vertex) with lazy deletion, so the
+//   shortest path tree is the same as the one of that textbook version.
+struct Dijkstra {
+    static constexpr long long INF = std::numeric_limits<long long>::max();
+    enum class Heap { radix, quaternary };
+
+    // cost[i] >= 0 is the cost of the edge of id i
+    Dijkstra(const CSRGraph& g, const std::vector<long long>& cost)
+        : n(g.size()), start(n + 1, 0) {
+        arcs.reserve(g.num_arcs());
+        for (int v = 0; v < n; v++) {
+            for (auto a : g[v]) {
+                assert(0 <= cost[a.id]);
+                arcs.push_back({a.to, a.id, cost[a.id]});
+            }
+            start[v + 1] = int(arcs.size());
+        }
+    }
+
+    // dist[v], INF if unreachable from the last source
+    std::vector<long long> dist;
+    // the previous vertex and the edge id on a shortest path, -1 for the
+    // source and unreachable vertices
+    std::vector<int> par, par_edge;
+
+    void run(int s, Heap heap) {
+        assert(0 <= s && s < n);
+        dist.assign(n, INF);
+        par.assign(n, -1);
+        par_edge.assign(n, -1);
+        dist[s] = 0;
+        if (heap == Heap::radix) {
+            run_radix(s);
+        } else {
+            run_quaternary(s);
+        }
+    }
+
+    // the vertices of a shortest path from the source to t, empty if t is
+    // unreachable
+    std::vector<int> path(int t) const {
+        if (dist[t] == INF) return {};
+        std::vector<int> res;
+        for (int v = t; v != -1; v = par[v]) res.push_back(v);
+        return {res.rbegin(), res.rend()};
+    }
+
+  private:
+    struct Arc {
+        int to, id;
+        long long cost;
+    };
+
+    int n;
+    std::vector<int> start;
+    std::vector<Arc> arcs;
+
+    // relax the arcs of v at distance d, push(to, new distance) on success
+    template <class F> void relax(int v, long long d, F push) {
+        const Arc* end = arcs.data() + start[v + 1];
+        for (const Arc* a = arcs.data() + start[v]; a != end; a++) {
+            long long nd = d + a->cost;
+            if (nd < dist[a->to]) {
+                dist[a->to] = nd;
+                par[a->to] = v;
+                par_edge[a->to] = a->id;
+                push(a->to, nd);
+            }
+        }
+    }
+
+    void run_radix(int s) {
+        RadixHeap<int> que;
+        que.push(0, s);
+        while (!que.empty()) {
+            auto [d, v] = que.pop();
+            if ((long long)d != dist[v]) continue;
+            relax(v, dist[v], [&](int to, long long nd) { que.push(std::uint64_t(nd), to); });
+        }
+    }
+
+    void run_quaternary(int s) {
+        IndexedQuaternaryHeap<long long> que(n);
+        que.push_or_decrease(s, 0);
+        while (!que.empty()) {
+            auto [d, v] = que.pop();
+            relax(v, d, [&](int to, long long nd) { que.push_or_decrease(to, nd); });
+        }
+    }
+};
+
+}  // namespace library_checker
@@ -1,17 +1,27 @@
 #pragma once
 
 #include <unistd.h>
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include <algorithm>
 #include <array>
 #include <bit>
 #include <cassert>
 #include <cctype>
+#include <climits>
+#include <cstdint>
 #include <cstring>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#if defined(__SSE2__) && !defined(__CHAR_UNSIGNED__)
+#include <emmintrin.h>
+#endif
+
 namespace library_checker {
 
 template <class T> struct make_unsigned {
@@ -34,7 +44,15 @@ struct Scanner {
     Scanner(const Scanner&) = delete;
     Scanner& operator=(const Scanner&) = delete;
 
-    Scanner(FILE* fp) : fd(fileno(fp)) { buf[0] = 127; }
+    Scanner(FILE* fp) : fd(fileno(fp)) {
+        buf[0] = 127;
+        map_input();
+    }
+    ~Scanner() {
+#if __has_include(<sys/mman.h>)
+        if (map_addr) munmap(map_addr, map_len);
+#endif
+    }
 
     void read() {}
     template <class H, class... T> void read(H& h, T&... t) {
@@ -43,6 +61,14 @@ struct Scanner {
         read(t...);
     }
 
+    // read n integers into a[0..n)
+    template <class T> void read_array(T* a, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            bool f = read_single(a[i]);
+            assert(f);
+        }
+    }
+
   private:
     bool read_single(int& v) { return read_signed(v); }
     bool read_single(long& v) { return read_signed(v); }
@@ -55,12 +81,57 @@ struct Scanner {
     bool read_single(unsigned __int128& v) { return read_unsigned(v); }
 
     static constexpr int BUF_SIZE = 1 << 15;
+    // chunked parsing may read buf[ed + 1..ed + PADDING)
+    static constexpr int PADDING = 32;
 
     int fd;  // file descriptor
-    std::array<char, BUF_SIZE + 1> buf;
+    std::array<char, BUF_SIZE + 1 + PADDING> buffer{};
+    char* buf = buffer.data();  // buffer, or the whole input if mapped
     int st = 0, ed = 0;  // available range of buf. buf[ed] must be 127.
     bool eof = false;
 
+    void* map_addr = nullptr;
+    size_t map_len = 0;
+
+    // if fd is a regular file, map the rest of it and tokenize it in place
+    void map_input() {
+#if __has_include(<sys/mman.h>)
+        struct stat info;
+        if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode)) return;
+        off_t offset = lseek(fd, 0, SEEK_CUR);
+        if (offset == -1 || offset > info.st_size) return;
+
+        off_t page = sysconf(_SC_PAGESIZE);
+        off_t begin = offset / page * page;  // mmap needs aligned offset
+        size_t len = size_t(info.st_size - begin);
+        if (len > size_t(INT_MAX - 2 - PADDING)) return;
+
+        // file, '\0', 127 and padding. pages after the file are anonymous
+        size_t total = (len + 2 + PADDING + size_t(page) - 1) / size_t(page) *
+                       size_t(page);
+        void* addr = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) return;
+        if (len && mmap(addr, len, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_FIXED, fd, begin) == MAP_FAILED) {
+            munmap(addr, total);
+            return;
+        }
+        if (len) madvise(addr, len, MADV_SEQUENTIAL);
+        map_addr = addr;
+        map_len = total;
+
+        // same state as read_input() after reaching EOF
+        buf = static_cast<char*>(addr);
+        st = int(offset - begin);
+        ed = int(len);
+        buf[ed++] = '\0';
+        buf[ed] = 127;
+        eof = true;
+        lseek(fd, 0, SEEK_END);
+#endif
+    }
+
     template <class T> bool read_signed(T& v) {
         if (!skip_blanks<50>()) return false;
 
@@ -87,19 +158,48 @@ struct Scanner {
 
     template <class T> void read_unsigned_internal(T& v) {
         v = 0;
-        do {
+        std::uint64_t chunk;
+        while (parse_8_digits(buf + st, chunk)) {
+            v = T(v * T(100000000) + T(chunk));
+            st += 8;
+        }
+        while (is_digit(buf[st])) {
             v = 10 * v + (buf[st++] & 0x0f);
-        } while (is_digit(buf[st]));
+        }
+    }
+
+    // if p[0..8) are all digits, v = (integer of them) and return true
+    static bool parse_8_digits([[maybe_unused]] const char* p,
+                               [[maybe_unused]] std::uint64_t& v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        std::uint64_t x;
+        std::memcpy(&x, p, 8);
+        // '0'..'9' = 0x30..0x39: high nibble is 3, and it remains 3 after +6
+        constexpr std::uint64_t HIGH = 0xf0f0f0f0f0f0f0f0;
+        if ((x & HIGH) != 0x3030303030303030 ||
+            ((x + 0x0606060606060606) & HIGH) != 0x3030303030303030) {
+            return false;
+        }
+        x &= 0x0f0f0f0f0f0f0f0f;
+        // p[0] is the lowest byte, merge adjacent 1, 2, 4 digits
+        x = (x * 10 + (x >> 8)) & 0x00ff00ff00ff00ff;
+        x = (x * 100 + (x >> 16)) & 0x0000ffff0000ffff;
+        x = (x * 10000 + (x >> 32)) & 0x00000000ffffffff;
+        v = x;
+        return true;
+#else
+        return false;
+#endif
     }
 
     void read_input() {
         assert(!eof);
 
-        std::memmove(buf.data(), buf.data() + st, ed - st);
+        std::memmove(buf, buf + st, ed - st);
         ed -= st;
         st = 0;
 
-        int u = int(::read(fd, buf.data() + ed, BUF_SIZE - ed));
+        int u = int(::read(fd, buf + ed, BUF_SIZE - ed));
         if (u == 0) {
             eof = true;
             buf[ed] = '\0';
@@ -110,10 +210,34 @@ struct Scanner {
         buf[ed] = 127;
     }
 
+    // skip blanks of buf[st..ed], it stops at buf[ed] = 127
+    void skip_blank_chars() {
+        if (!is_blank(buf[st])) return;
+        st++;
+        // usually tokens are separated by a single blank
+        if (!is_blank(buf[st])) return;
+#if defined(__SSE2__) && !defined(__CHAR_UNSIGNED__)
+        // signed comparison, the same as is_blank
+        const __m128i blank = _mm_set1_epi8(' ');
+        while (true) {
+            __m128i x = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(buf + st));
+            int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(x, blank));
+            if (mask) {
+                st += __builtin_ctz(mask);
+                return;
+            }
+            st += 16;
+        }
+#else
+        while (is_blank(buf[st])) st++;
+#endif
+    }
+
     // skip blanks and assume next token is in buffer
     template <int MAX_TOKEN_LEN> bool skip_blanks() {
         while (true) {
-            while (is_blank(buf[st])) st++;
+            skip_blank_chars();
             if (ed - st > MAX_TOKEN_LEN) return true;
             // std::cerr << st << " " << ed << " " << eof << std::endl;
             if (eof) return (st < ed);
@@ -143,6 +267,15 @@ struct Printer {
         write_single('\n');
     }
 
+    // write v[0], sep, v[1], ..., sep, v[n - 1]
+    template <class T>
+    void write_array(const std::vector<T>& v, char sep = ' ') {
+        for (size_t i = 0; i < v.size(); i++) {
+            if (i) write_single(sep);
+            write_single(v[i]);
+        }
+    }
+
     void flush() {
         if (pos) {
             auto res = ::write(fd, buf.data(), pos);
@@ -256,19 +389,35 @@ struct Printer {
         }
     }
 
-    // TODO: optimize
     template <class U, std::enable_if_t<16 == sizeof(U)>* = nullptr>
     void write_unsigned_internal(U v) {
-        static std::array<char, 50> buf2;
+        // split into 19-digit blocks, each of them fits in unsigned long long
+        constexpr unsigned long long TEN19 = 10000000000000000000ULL;
+        if (v < TEN19) {
+            write_unsigned_internal((unsigned long long)v);
+            return;
+        }
+        U upper = v / TEN19;
+        unsigned long long lower = (unsigned long long)(v % TEN19);
+        if (upper < TEN19) {
+            write_unsigned_internal((unsigned long long)upper);
+        } else {
+            write_unsigned_internal((unsigned long long)(upper / TEN19));
+            write_19_digits((unsigned long long)(upper % TEN19));
+        }
+        write_19_digits(lower);
+    }
 
-        size_t len = 0;
-        while (v > 0) {
-            buf2[len++] = char((v % 10) + '0');
-            v /= 10;
+    // write v in exactly 19 digits, padded by '0'
+    void write_19_digits(unsigned long long v) {
+        pos += 19;
+        char* ptr = buf.data() + pos;
+        for (int i = 0; i < 9; i++) {
+            ptr -= 2;
+            memcpy(ptr, small[v % 100].data(), 2);
+            v /= 100;
         }
-        std::reverse(buf2.begin(), buf2.begin() + len);
-        memcpy(buf.data() + pos, buf2.data(), len);
-        pos += len;
+        *(ptr - 1) = char('0' + v);
     }
 
     // to_string_size(v) = to_string(v).size()
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace library_checker {
+
+// Static graph in compressed sparse row form.
+//
+// Arcs are {to, id} with 32-bit fields, stored in one array and grouped by
+// their tail; start[v] is the first arc of v. The arrays are filled by a
+// counting sort in two passes over the edge list, so the arcs of a vertex
+// keep the order of the edges, the same order as push_back into a
+// vector<vector<>>, with two allocations in total.
+struct CSRGraph {
+    struct Arc {
+        int to, id;
+    };
+    struct Range {
+        const Arc *first, *last;
+        const Arc* begin() const { return first; }
+        const Arc* end() const { return last; }
+        int size() const { return int(last - first); }
+    };
+
+    CSRGraph() = default;
+
+    // edge i = (u, v) is the arc u -> v with id i
+    static CSRGraph directed(int n, const std::vector<std::pair<int, int>>& edges) {
+        return CSRGraph(n, edges, false);
+    }
+    // edge i = (u, v) is the arcs u -> v and v -> u with id i
+    static CSRGraph undirected(int n, const std::vector<std::pair<int, int>>& edges) {
+        return CSRGraph(n, edges, true);
+    }
+
+    int size() const { return n; }
+    int num_arcs() const { return int(arcs.size()); }
+    Range operator[](int v) const {
+        assert(0 <= v && v < n);
+        return {arcs.data() + start[v], arcs.data() + start[v + 1]};
+    }
+
+    // Depth first search with an explicit stack, so the depth is bounded by
+    // memory only. The visitor is called in the order of the recursive
+    //
+    //   for v in 0 .. n-1: if vis.root(v): visit(v)
+    //   visit(v):
+    //       vis.enter(v)
+    //       for arc a of v: if vis.arc(v, a): visit(a.to); vis.back(v, a)
+    //       vis.leave(v)
+    //
+    // The visitor decides which vertices are new, the search keeps no
+    // visited set of its own.
+    template <class Visitor> void dfs(Visitor& vis) const {
+        // (vertex, next arc)
+        std::vector<std::pair<int, int>> st;
+        for (int r = 0; r < n; r++) {
+            if (!vis.root(r)) continue;
+            vis.enter(r);
+            st.emplace_back(r, start[r]);
+            while (!st.empty()) {
+                auto& [v, i] = st.back();
+                if (i == start[v + 1]) {
+                    int u = v;
+                    vis.leave(u);
+                    st.pop_back();
+                    if (!st.empty()) {
+                        auto [p, j] = st.back();
+                        vis.back(p, arcs[j - 1]);
+                    }
+                    continue;
+                }
+                const Arc& a = arcs[i++];
+                if (vis.arc(v, a)) {
+                    vis.enter(a.to);
+                    st.emplace_back(a.to, start[a.to]);
+                }
+            }
+        }
+    }
+
+  private:
+    int n = 0;
+    std::vector<int> start;
+    std::vector<Arc> arcs;
+
+    CSRGraph(int n_, const std::vector<std::pair<int, int>>& edges, bool both)
+        : n(n_), start(n_ + 1, 0) {
+        for (auto [u, v] : edges) {
+            assert(0 <= u && u < n && 0 <= v && v < n);
+            start[u + 1]++;
+            if (both) start[v + 1]++;
+        }
+        for (int v = 0; v < n; v++) start[v + 1] += start[v];
+        arcs.resize(start[n]);
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (int i = 0; i < int(edges.size()); i++) {
+            auto [u, v] = edges[i];
+            arcs[pos[u]++] = {v, i};
+            if (both) arcs[pos[v]++] = {u, i};
+        }
+    }
+};
+
+// Strongly connected components by Tarjan's algorithm on CSRGraph::dfs.
+// The components are in topological order, the vertices of a component in
+// the order they are popped from Tarjan's stack.
+inline std::vector<std::vector<int>> strongly_connected_components(const CSRGraph& g) {
+    struct Visitor {
+        std::vector<int> ord, low, st;
+        std::vector<char> on_stack;
+        std::vector<std::vector<int>> groups;
+        int timer = 0;
+
+        bool root(int v) { return ord[v] == -1; }
+        void enter(int v) {
+            ord[v] = low[v] = timer++;
+            st.push_back(v);
+            on_stack[v] = true;
+        }
+        bool arc(int v, const CSRGraph::Arc& a) {
+            if (ord[a.to] == -1) return true;
+            if (on_stack[a.to]) low[v] = std::min(low[v], ord[a.to]);
+            return false;
+        }
+        void back(int v, const CSRGraph::Arc& a) { low[v] = std::min(low[v], low[a.to]); }
+        void leave(int v) {
+            if (low[v] != ord[v]) return;
+            std::vector<int> group;
+            while (true) {
+                int u = st.back();
+                st.pop_back();
+                on_stack[u] = false;
+                group.push_back(u);
+                if (u == v) break;
+            }
+            groups.push_back(std::move(group));
+        }
+    } vis;
+    int n = g.size();
+    vis.ord.assign(n, -1);
+    vis.low.assign(n, 0);
+    vis.on_stack.assign(n, false);
+    g.dfs(vis);
+    std::reverse(vis.groups.begin(), vis.groups.end());
+    return std::move(vis.groups);
+}
+
+// Lowlink of an undirected CSRGraph.
+//
+// ord is the preorder of the DFS forest, low[v] the smallest ord reachable
+// from the subtree of v with one back edge. The arc to the parent is
+// skipped by its id, so parallel edges count as back edges. Bridges,
+// articulation points and the 2-edge / biconnected components are derived
+// from it. g must outlive the LowLink.
+struct LowLink {
+    std::vector<int> ord, low;
+    // parent in the DFS forest and the id of the edge to it, -1 for a root
+    std::vector<int> par, par_edge;
+
+    explicit LowLink(const CSRGraph& g_) : g(g_) {
+        int n = g.size();
+        ord.assign(n, -1);
+        low.assign(n, 0);
+        par.assign(n, -1);
+        par_edge.assign(n, -1);
+        Visitor vis{*this};
+        g.dfs(vis);
+    }
+
+    // edge e = (u, v) is a bridge if it is a tree edge that nothing in the
+    // subtree below it jumps over
+    bool is_bridge(int e, int u, int v) const {
+        if (ord[u] > ord[v]) std::swap(u, v);
+        return par_edge[v] == e && ord[u] < low[v];
+    }
+
+    // ids of the bridges, sorted
+    std::vector<int> bridges() const {
+        std::vector<int> res;
+        for (int v = 0; v < g.size(); v++) {
+            if (par[v] != -1 && ord[par[v]] < low[v]) res.push_back(par_edge[v]);
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+    // sorted
+    std::vector<int> articulation_points() const {
+        int n = g.size();
+        std::vector<int> children(n, 0);
+        std::vector<char> cut(n, false);
+        for (int v = 0; v < n; v++) {
+            int p = par[v];
+            if (p == -1) continue;
+            children[p]++;
+            if (par[p] != -1 && low[v] >= ord[p]) cut[p] = true;
+        }
+        std::vector<int> res;
+        for (int v = 0; v < n; v++) {
+            if (cut[v] || (par[v] == -1 && children[v] >= 2)) res.push_back(v);
+        }
+        return res;
+    }
+
+    // Components after removing the bridges, ordered by their smallest
+    // vertex; each lists its vertices in the preorder of a DFS from that
+    // vertex that does not cross bridges.
+    std::vector<std::vector<int>> two_edge_connected_components() const {
+        struct Fill {
+            const LowLink& ll;
+            std::vector<int> comp;
+            std::vector<std::vector<int>> groups;
+
+            bool root(int v) {
+                if (comp[v] != -1) return false;
+                comp[v] = int(groups.size());
+                groups.emplace_back();
+                return true;
+            }
+            void enter(int v) { groups[comp[v]].push_back(v); }
+            bool arc(int v, const CSRGraph::Arc& a) {
+                if (comp[a.to] != -1 || ll.is_bridge(a.id, v, a.to)) return false;
+                comp[a.to] = comp[v];
+                return true;
+            }
+            void back(int, const CSRGraph::Arc&) {}
+            void leave(int) {}
+        } fill{*this, std::vector<int>(g.size(), -1), {}};
+        g.dfs(fill);
+        return std::move(fill.groups);
+    }
+
+    // Vertex sets of the biconnected components, a vertex without edges
+    // (other than self-loops) is a component by itself. The order is
+    // unspecified.
+    //
+    // A child v of p starts a new component with p iff low[v] >= ord[p],
+    // otherwise it is in the component of the tree edge into p.
+    std::vector<std::vector<int>> biconnected_components() const {
+        int n = g.size();
+        std::vector<std::vector<int>> res;
+        std::vector<int> comp(n, -1), order(n);
+        std::vector<char> has_child(n, false);
+        for (int v = 0; v < n; v++) {
+            order[ord[v]] = v;
+            if (par[v] != -1) has_child[par[v]] = true;
+        }
+        for (int v : order) {
+            int p = par[v];
+            if (p == -1) {
+                if (!has_child[v]) res.push_back({v});
+            } else if (low[v] >= ord[p]) {
+                comp[v] = int(res.size());
+                res.push_back({p, v});
+            } else {
+                comp[v] = comp[p];
+                res[comp[v]].push_back(v);
+            }
+        }
+        return res;
+    }
+
+  private:
+    const CSRGraph& g;
+
+    struct Visitor {
+        LowLink& ll;
+        int timer = 0;
+
+        bool root(int v) { return ll.ord[v] == -1; }
+        void enter(int v) { ll.ord[v] = ll.low[v] = timer++; }
+        bool arc(int v, const CSRGraph::Arc& a) {
+            if (a.id == ll.par_edge[v]) return false;
+            if (ll.ord[a.to] == -1) {
+                ll.par[a.to] = v;
+                ll.par_edge[a.to] = a.id;
+                return true;
+            }
+            ll.low[v] = std::min(ll.low[v], ll.ord[a.to]);
+            return false;
+        }
+        void back(int v, const CSRGraph::Arc& a) { ll.low[v] = std::min(ll.low[v], ll.low[a.to]); }
+        void leave(int) {}
+    };
+};
+
+// 3-edge-connected components of an undirected CSRGraph, by the one-pass
+// lowpoint / path absorption algorithm on CSRGraph::dfs. Vertices absorbed
+// into one component are linked in a cyclic list; the components are listed
+// by their smallest vertex, each following its list from that vertex.
+inline std::vector<std::vector<int>> three_edge_connected_components(const CSRGraph& g) {
+    int n = g.size();
+    struct Visitor {
+        int n, count = 0;
+        std::vector<int> in, out, low, deg, path, par, next;
+        std::vector<char> visited;
+
+        // the two cyclic lists become one
+        void absorb(int v, int w) {
+            std::swap(next[v], next[w]);
+            deg[v] += deg[w];
+        }
+
+        bool root(int v) {
+            if (visited[v]) return false;
+            par[v] = n;
+            return true;
+        }
+        void enter(int v) {
+            visited[v] = true;
+            in[v] = count++;
+        }
+        bool arc(int v, const CSRGraph::Arc& a) {
+            int w = a.to;
+            if (w == v) return false;
+            if (w == par[v]) {
+                // the tree edge, a parallel edge to the parent is a back edge
+                par[v] = n;
+                return false;
+            }
+            if (!visited[w]) {
+                par[w] = v;
+                return true;
+            }
+            if (in[w] < in[v]) {
+                deg[v]++;
+                low[v] = std::min(low[v], in[w]);
+            } else {
+                deg[v]--;
+                int u = path[v];
+                while (u != n && in[u] <= in[w] && in[w] < out[u]) {
+                    absorb(v, u);
+                    u = path[u];
+                }
+                path[v] = u;
+            }
+            return false;
+        }
+        void back(int v, const CSRGraph::Arc& a) {
+            int w = a.to;
+            if (path[w] == n && deg[w] <= 1) {
+                deg[v] += deg[w];
+                low[v] = std::min(low[v], low[w]);
+                return;
+            }
+            if (deg[w] == 0) w = path[w];
+            if (low[w] < low[v]) {
+                low[v] = low[w];
+                std::swap(w, path[v]);
+            }
+            for (; w != n; w = path[w]) absorb(v, w);
+        }
+        void leave(int v) { out[v] = count; }
+    } vis{n, 0, std::vector<int>(n), std::vector<int>(n), std::vector<int>(n, n),
+          std::vector<int>(n, 0), std::vector<int>(n, n), std::vector<int>(n, n),
+          std::vector<int>(n), std::vector<char>(n, false)};
+    for (int v = 0; v < n; v++) vis.next[v] = v;
+    g.dfs(vis);
+
+    std::vector<std::vector<int>> res;
+    std::vector<char> listed(n, false);
+    for (int v = 0; v < n; v++) {
+        if (listed[v]) continue;
+        std::vector<int> group;
+        int u = v;
+        do {
+            group.push_back(u);
+            listed[u] = true;
+            u = vis.next[u];
+        } while (u != v);
+        res.push_back(std::move(group));
+    }
+    return res;
+}
+
+}  // namespace library_checker
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define LIBRARY_CHECKER_HASH_MAP_SSE2
+#endif
+
+namespace library_checker {
+
+// splitmix64 of an integer key with a per-process random seed, so inputs
+// built against a fixed hash (std::hash is the identity for integers) are
+// spread like random keys.
+struct SplitMix64Hash {
+    template <class K> std::uint64_t operator()(const K& key) const {
+        static_assert(std::is_integral<K>::value || std::is_enum<K>::value);
+        return mix(std::uint64_t(key) + seed());
+    }
+
+    static std::uint64_t mix(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+    static std::uint64_t seed() {
+        static const std::uint64_t s = mix(std::uint64_t(
+            std::chrono::steady_clock::now().time_since_epoch().count()));
+        return s;
+    }
+};
+
+// Open addressing hash map in the style of Swiss tables.
+//
+// Slots are split into groups of 16, and each slot has a control byte:
+// EMPTY, DELETED, or the low 7 bits of the hash of its key. A lookup starts
+// at the group given by the other bits of the hash, compares the 16 control
+// bytes of the group with the 7 bits at once (one SSE2 compare), checks the
+// keys of the matches only, and stops at a group with an EMPTY slot. Groups
+// are probed triangularly. The load factor is kept under 7/8.
+//
+// Keys and values live in one flat array, K and V must be default
+// constructible.
+template <class K, class V, class Hash = SplitMix64Hash> struct HashMap {
+    HashMap() = default;
+    explicit HashMap(std::size_t n) { reserve(n); }
+
+    std::size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+
+    // no rehash until size() reaches n
+    void reserve(std::size_t n) {
+        std::size_t cap = GROUP;
+        while (cap / 8 * 7 < n) cap *= 2;
+        if (cap > ctrl.size()) rehash(cap);
+    }
+
+    V* find(const K& key) {
+        std::size_t i = find_index(key);
+        return i == NPOS ? nullptr : &slots[i].second;
+    }
+    const V* find(const K& key) const {
+        std::size_t i = find_index(key);
+        return i == NPOS ? nullptr : &slots[i].second;
+    }
+    bool contains(const K& key) const { return find_index(key) != NPOS; }
+
+    // inserts V() if key is absent
+    V& operator[](const K& key) {
+        std::size_t i = find_index(key);
+        if (i != NPOS) return slots[i].second;
+        if ((len + deleted + 1) > ctrl.size() / 8 * 7) {
+            // grow, or only clean up tombstones when they are the majority
+            rehash(len + 1 > ctrl.size() / 16 * 7 ? std::max(2 * ctrl.size(), GROUP)
+                                                  : ctrl.size());
+        }
+        std::uint64_t h = Hash()(key);
+        i = find_free(h);
+        if (ctrl[i] == DELETED) deleted--;
+        ctrl[i] = h2(h);
+        slots[i].first = key;
+        slots[i].second = V();
+        len++;
+        return slots[i].second;
+    }
+
+    bool erase(const K& key) {
+        std::size_t i = find_index(key);
+        if (i == NPOS) return false;
+        ctrl[i] = DELETED;
+        slots[i].second = V();
+        len--;
+        deleted++;
+        return true;
+    }
+
+    // f(key, value) for every entry, in no particular order
+    template <class F> void for_each(F f) {
+        for (std::size_t i = 0; i < ctrl.size(); i++) {
+            if (is_full(ctrl[i])) f(slots[i].first, slots[i].second);
+        }
+    }
+
+  private:
+    static constexpr std::size_t GROUP = 16;
+    static constexpr std::size_t NPOS = ~std::size_t(0);
+    static constexpr std::int8_t EMPTY = -128;
+    static constexpr std::int8_t DELETED = -2;
+
+    // control bytes, EMPTY / DELETED / low 7 bits of the hash
+    std::vector<std::int8_t> ctrl;
+    std::vector<std::pair<K, V>> slots;
+    std::size_t len = 0, deleted = 0;
+
+    static bool is_full(std::int8_t c) { return c >= 0; }
+    static std::int8_t h2(std::uint64_t h) { return std::int8_t(h & 0x7f); }
+    std::size_t first_group(std::uint64_t h) const {
+        return std::size_t(h >> 7) & (ctrl.size() / GROUP - 1);
+    }
+
+    // bit i is set if ctrl[g + i] == c
+    std::uint32_t match(std::size_t g, std::int8_t c) const {
+#if defined(LIBRARY_CHECKER_HASH_MAP_SSE2)
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data() + g));
+        return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8(c))));
+#else
+        std::uint32_t res = 0;
+        for (std::size_t i = 0; i < GROUP; i++) res |= std::uint32_t(ctrl[g + i] == c) << i;
+        return res;
+#endif
+    }
+    // bit i is set if ctrl[g + i] is EMPTY or DELETED
+    std::uint32_t match_free(std::size_t g) const {
+#if defined(LIBRARY_CHECKER_HASH_MAP_SSE2)
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl.data() + g));
+        return std::uint32_t(_mm_movemask_epi8(x));
+#else
+        std::uint32_t res = 0;
+        for (std::size_t i = 0; i < GROUP; i++) res |= std::uint32_t(!is_full(ctrl[g + i])) << i;
+        return res;
+#endif
+    }
+
+    std::size_t find_index(const K& key) const {
+        if (ctrl.empty()) return NPOS;
+        std::uint64_t h = Hash()(key);
+        std::int8_t c = h2(h);
+        std::size_t mask = ctrl.size() / GROUP - 1;
+        for (std::size_t g = first_group(h), step = 1;; g = (g + step++) & mask) {
+            std::size_t base = g * GROUP;
+            for (std::uint32_t m = match(base, c); m; m &= m - 1) {
+                std::size_t i = base + __builtin_ctz(m);
+                if (slots[i].first == key) return i;
+            }
+            if (match(base, EMPTY)) return NPOS;
+        }
+    }
+
+    // first EMPTY or DELETED slot on the probe sequence of h
+    std::size_t find_free(std::uint64_t h) const {
+        std::size_t mask = ctrl.size() / GROUP - 1;
+        for (std::size_t g = first_group(h), step = 1;; g = (g + step++) & mask) {
+            std::uint32_t m = match_free(g * GROUP);
+            if (m) return g * GROUP + __builtin_ctz(m);
+        }
+    }
+
+    void rehash(std::size_t cap) {
+        assert(cap >= GROUP && (cap & (cap - 1)) == 0);
+        std::vector<std::int8_t> old_ctrl(cap, EMPTY);
+        std::vector<std::pair<K, V>> old_slots(cap);
+        std::swap(ctrl, old_ctrl);
+        std::swap(slots, old_slots);
+        deleted = 0;
+        for (std::size_t i = 0; i < old_ctrl.size(); i++) {
+            if (!is_full(old_ctrl[i])) continue;
+            std::uint64_t h = Hash()(old_slots[i].first);
+            std::size_t j = find_free(h);
+            ctrl[j] = h2(h);
+            slots[j] = std::move(old_slots[i]);
+        }
+    }
+};
+
+}  // namespace library_checker
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace library_checker {
+
+// Lazy segment tree on a monoid S acted on by a monoid F.
+//
+// The tree is 1-indexed and bottom-up: leaves are at [size, 2 size) and
+// prod / apply walk from the leaves of [l, r) to the root without recursion,
+// pushing the lazies of the boundary paths only. The interface follows
+// AtCoder Library (set, get, prod, all_prod, apply, max_right, min_left).
+//
+// mapping(f, x) is f applied to x, composition(f, g) is f after g.
+template <class S,
+          S (*op)(S, S),
+          S (*e)(),
+          class F,
+          S (*mapping)(F, S),
+          F (*composition)(F, F),
+          F (*id)()>
+struct LazySegTree {
+    LazySegTree() : LazySegTree(0) {}
+    explicit LazySegTree(int n_) : LazySegTree(std::vector<S>(n_, e())) {}
+    explicit LazySegTree(const std::vector<S>& v) : n(int(v.size())) {
+        lg = 0;
+        while ((1 << lg) < n) lg++;
+        size = 1 << lg;
+        d = std::vector<S>(2 * size, e());
+        lz = std::vector<F>(size, id());
+        for (int i = 0; i < n; i++) d[size + i] = v[i];
+        for (int i = size - 1; i >= 1; i--) update(i);
+    }
+
+    void set(int p, S x) {
+        assert(0 <= p && p < n);
+        p += size;
+        for (int i = lg; i >= 1; i--) push(p >> i);
+        d[p] = x;
+        for (int i = 1; i <= lg; i++) update(p >> i);
+    }
+
+    S get(int p) {
+        assert(0 <= p && p < n);
+        p += size;
+        for (int i = lg; i >= 1; i--) push(p >> i);
+        return d[p];
+    }
+
+    S prod(int l, int r) {
+        assert(0 <= l && l <= r && r <= n);
+        if (l == r) return e();
+        l += size;
+        r += size;
+        for (int i = lg; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        S sml = e(), smr = e();
+        while (l < r) {
+            if (l & 1) sml = op(sml, d[l++]);
+            if (r & 1) smr = op(d[--r], smr);
+            l >>= 1;
+            r >>= 1;
+        }
+        return op(sml, smr);
+    }
+
+    S all_prod() const { return d[1]; }
+
+    // Answers prod(l, r) of each query, in the order of the queries.
+    //
+    // The queries are run in increasing order of l (ties by r), so that
+    // consecutive queries push mostly the same boundary paths: after the
+    // first of them the lazies on the shared path are already id, and the
+    // nodes they touch are still in cache. Use it for runs of queries with
+    // no update between them.
+    std::vector<S> prod_batch(const std::vector<std::pair<int, int>>& queries) {
+        int q = int(queries.size());
+        std::vector<int> order(q);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int i, int j) {
+            return queries[i] < queries[j];
+        });
+        std::vector<S> res(q);
+        for (int i : order) res[i] = prod(queries[i].first, queries[i].second);
+        return res;
+    }
+
+    void apply(int p, F f) {
+        assert(0 <= p && p < n);
+        p += size;
+        for (int i = lg; i >= 1; i--) push(p >> i);
+        d[p] = mapping(f, d[p]);
+        for (int i = 1; i <= lg; i++) update(p >> i);
+    }
+
+    void apply(int l, int r, F f) {
+        assert(0 <= l && l <= r && r <= n);
+        if (l == r) return;
+        l += size;
+        r += size;
+        for (int i = lg; i >= 1; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        {
+            int l2 = l, r2 = r;
+            while (l < r) {
+                if (l & 1) all_apply(l++, f);
+                if (r & 1) all_apply(--r, f);
+                l >>= 1;
+                r >>= 1;
+            }
+            l = l2;
+            r = r2;
+        }
+        for (int i = 1; i <= lg; i++) {
+            if (((l >> i) << i) != l) update(l >> i);
+            if (((r >> i) << i) != r) update((r - 1) >> i);
+        }
+    }
+
+    // largest r such that g(prod(l, r)) is true, g(e()) must be true
+    template <class G> int max_right(int l, G g) {
+        assert(0 <= l && l <= n);
+        assert(g(e()));
+        if (l == n) return n;
+        l += size;
+        for (int i = lg; i >= 1; i--) push(l >> i);
+        S sm = e();
+        do {
+            while (l % 2 == 0) l >>= 1;
+            if (!g(op(sm, d[l]))) {
+                while (l < size) {
+                    push(l);
+                    l = 2 * l;
+                    if (g(op(sm, d[l]))) {
+                        sm = op(sm, d[l]);
+                        l++;
+                    }
+                }
+                return l - size;
+            }
+            sm = op(sm, d[l]);
+            l++;
+        } while ((l & -l) != l);
+        return n;
+    }
+
+    // smallest l such that g(prod(l, r)) is true, g(e()) must be true
+    template <class G> int min_left(int r, G g) {
+        assert(0 <= r && r <= n);
+        assert(g(e()));
+        if (r == 0) return 0;
+        r += size;
+        for (int i = lg; i >= 1; i--) push((r - 1) >> i);
+        S sm = e();
+        do {
+            r--;
+            while (r > 1 && (r % 2)) r >>= 1;
+            if (!g(op(d[r], sm))) {
+                while (r < size) {
+                    push(r);
+                    r = 2 * r + 1;
+                    if (g(op(d[r], sm))) {
+                        sm = op(d[r], sm);
+                        r--;
+                    }
+                }
+                return r + 1 - size;
+            }
+            sm = op(d[r], sm);
+        } while ((r & -r) != r);
+        return 0;
+    }
+
+  private:
+    int n, size, lg;
+    std::vector<S> d;
+    // lazies of internal nodes only, leaves never push
+    std::vector<F> lz;
+
+    void update(int k) { d[k] = op(d[2 * k], d[2 * k + 1]); }
+    void all_apply(int k, F f) {
+        d[k] = mapping(f, d[k]);
+        if (k < size) lz[k] = composition(f, lz[k]);
+    }
+    void push(int k) {
+        all_apply(2 * k, lz[k]);
+        all_apply(2 * k + 1, lz[k]);
+        lz[k] = id();
+    }
+};
+
+// Range affine (x -> a x + b) and range sum over Z/MOD, MOD is odd and
+// < 2^30.
+//
+// Every value is kept in Montgomery form (x * 2^32 mod MOD), so mapping and
+// composition are a few Montgomery multiplications instead of 64-bit
+// divisions. The length of a node is stored in Montgomery form as well,
+// which turns b * len into one more multiplication.
+template <std::uint32_t MOD> struct AffineSum {
+    static_assert(MOD % 2 == 1 && MOD < (1u << 30));
+
+    // -MOD^{-1} mod 2^32
+    static constexpr std::uint32_t NEG_INV = [] {
+        std::uint32_t x = MOD;
+        for (int i = 0; i < 4; i++) x *= 2 - MOD * x;
+        return -x;
+    }();
+    static constexpr std::uint32_t R2 = std::uint32_t((-std::uint64_t(MOD)) % MOD);  // 2^64 mod MOD
+
+    // x / 2^32 mod MOD, in [0, MOD) if x < 2^32 MOD
+    static std::uint32_t reduce(std::uint64_t x) {
+        std::uint32_t r = std::uint32_t(
+            (x + std::uint64_t(std::uint32_t(x) * NEG_INV) * MOD) >> 32);
+        return r >= MOD ? r - MOD : r;
+    }
+    static std::uint32_t mul(std::uint32_t a, std::uint32_t b) {
+        return reduce(std::uint64_t(a) * b);
+    }
+    // a * b + c * d in Montgomery form, a, b, c, d < MOD
+    static std::uint32_t mul_add(std::uint32_t a, std::uint32_t b,
+                                 std::uint32_t c, std::uint32_t d) {
+        return reduce(std::uint64_t(a) * b + std::uint64_t(c) * d);
+    }
+    static std::uint32_t add(std::uint32_t a, std::uint32_t b) {
+        std::uint32_t r = a + b;
+        return r >= MOD ? r - MOD : r;
+    }
+    // a < MOD <-> Montgomery form
+    static std::uint32_t to_mont(std::uint32_t a) { return mul(a, R2); }
+    static std::uint32_t from_mont(std::uint32_t a) { return reduce(a); }
+
+    struct S {
+        std::uint32_t sum, len;
+    };
+    struct F {
+        std::uint32_t a, b;
+    };
+
+    static S op(S l, S r) { return {add(l.sum, r.sum), add(l.len, r.len)}; }
+    static S e() { return {0, 0}; }
+    static S mapping(F f, S x) { return {mul_add(f.a, x.sum, f.b, x.len), x.len}; }
+    // x -> f.a (g.a x + g.b) + f.b
+    static F composition(F f, F g) {
+        return {mul(f.a, g.a), add(mul(f.a, g.b), f.b)};
+    }
+    static F id() { return {to_mont(1 % MOD), 0}; }
+
+    // leaf of value x < MOD
+    static S leaf(std::uint32_t x) { return {to_mont(x), to_mont(1 % MOD)}; }
+    // x -> a x + b, a, b < MOD
+    static F affine(std::uint32_t a, std::uint32_t b) {
+        return {to_mont(a), to_mont(b)};
+    }
+    static std::uint32_t value(S x) { return from_mont(x.sum); }
+
+    using Tree = LazySegTree<S, op, e, F, mapping, composition, id>;
+};
+
+}  // namespace library_checker
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "cpu_features.h"
+
+namespace library_checker {
+
+// Dense matrix over Z/MOD, MOD is odd and < 2^30.
+// Entries are plain integers in [0, MOD), packed in row-major order.
+template <std::uint32_t MOD> struct Matrix {
+    static_assert(MOD % 2 == 1 && MOD < (1u << 30));
+
+    int h = 0, w = 0;
+    std::vector<std::uint32_t> a;
+
+    Matrix() = default;
+    Matrix(int h_, int w_) : h(h_), w(w_), a(std::size_t(h_) * w_) {}
+
+    static Matrix identity(int n) {
+        Matrix res(n, n);
+        for (int i = 0; i < n; i++) res[i][i] = 1 % MOD;
+        return res;
+    }
+
+    std::uint32_t* operator[](int i) { return a.data() + std::size_t(i) * w; }
+    const std::uint32_t* operator[](int i) const {
+        return a.data() + std::size_t(i) * w;
+    }
+
+    bool operator==(const Matrix& r) const {
+        return h == r.h && w == r.w && a == r.a;
+    }
+};
+
+// Kernels of matrix operations.
+//
+// The product is computed on 4x8 output tiles. A is packed by 4 rows and B
+// by 8 columns so that the micro-kernel reads both sequentially, and a tile
+// keeps 64-bit lazy sums of a_ik * b_kj in registers. Every 8 terms the sums
+// are folded as lo + hi * (2^32 mod MOD), which keeps them below 2^63, so
+// only one division per output entry is needed.
+//
+// On x86 CPUs with AVX2, a tile is 8 registers of 4 x 64-bit lanes.
+template <std::uint32_t MOD> struct MatrixKernel {
+    static_assert(MOD % 2 == 1 && MOD < (1u << 30));
+
+    static constexpr int TILE_H = 4;
+    static constexpr int TILE_W = 8;
+    // terms accumulated between two folds
+    static constexpr int FOLD = 8;
+    // tiles of B processed together, TILE_W * STRIPS columns of B should fit
+    // in L2 cache
+    static constexpr int STRIPS = 8;
+
+    // 2^32 mod MOD
+    static constexpr std::uint64_t R32 = (std::uint64_t(1) << 32) % MOD;
+    // -MOD^{-1} mod 2^32
+    static constexpr std::uint32_t NEG_INV = []() {
+        std::uint32_t inv = MOD;
+        for (int i = 0; i < 5; i++) inv *= 2 - MOD * inv;
+        return -inv;
+    }();
+
+    static std::uint64_t fold(std::uint64_t x) {
+        return (x & 0xffffffffu) + (x >> 32) * R32;
+    }
+
+    // x * y * 2^{-32} mod MOD in [0, 2 MOD), x * y < MOD * 2^32
+    static std::uint32_t reduce(std::uint64_t x) {
+        std::uint32_t q = std::uint32_t(x) * NEG_INV;
+        return std::uint32_t((x + std::uint64_t(q) * MOD) >> 32);
+    }
+
+    // c[0..4)[0..8) = a(4 x m) * b(m x 8), both packed
+    static void tile(const std::uint32_t* a, const std::uint32_t* b, int m,
+                     std::uint64_t (*c)[TILE_W]) {
+        for (int i = 0; i < TILE_H; i++) {
+            for (int j = 0; j < TILE_W; j++) c[i][j] = 0;
+        }
+        for (int k0 = 0; k0 < m; k0 += FOLD) {
+            int k1 = std::min(m, k0 + FOLD);
+            for (int k = k0; k < k1; k++) {
+                for (int i = 0; i < TILE_H; i++) {
+                    std::uint64_t x = a[k * TILE_H + i];
+                    for (int j = 0; j < TILE_W; j++) {
+                        c[i][j] += x * b[k * TILE_W + j];
+                    }
+                }
+            }
+            for (int i = 0; i < TILE_H; i++) {
+                for (int j = 0; j < TILE_W; j++) c[i][j] = fold(c[i][j]);
+            }
+        }
+    }
+
+    // x[i] = x[i] - c * y[i] mod MOD, where cr = c * 2^32 mod MOD
+    static void sub_mul(std::uint32_t* x, const std::uint32_t* y,
+                        std::uint32_t cr, int n) {
+        for (int i = 0; i < n; i++) {
+            std::uint32_t t = reduce(std::uint64_t(y[i]) * cr);
+            if (t >= MOD) t -= MOD;
+            x[i] = x[i] >= t ? x[i] - t : x[i] + MOD - t;
+        }
+    }
+
+#if defined(LIBRARY_CHECKER_X86)
+    __attribute__((target("avx2"))) static __m256i fold_avx2(__m256i x) {
+        const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+        const __m256i r32 = _mm256_set1_epi64x(std::int64_t(R32));
+        return _mm256_add_epi64(_mm256_and_si256(x, mask),
+                                _mm256_mul_epu32(_mm256_srli_epi64(x, 32), r32));
+    }
+
+    // same as above. even and odd columns are accumulated separately
+    __attribute__((target("avx2"))) static void tile_avx2(
+        const std::uint32_t* a, const std::uint32_t* b, int m,
+        std::uint64_t (*c)[TILE_W]) {
+        __m256i e0 = _mm256_setzero_si256(), o0 = _mm256_setzero_si256();
+        __m256i e1 = _mm256_setzero_si256(), o1 = _mm256_setzero_si256();
+        __m256i e2 = _mm256_setzero_si256(), o2 = _mm256_setzero_si256();
+        __m256i e3 = _mm256_setzero_si256(), o3 = _mm256_setzero_si256();
+        for (int k0 = 0; k0 < m; k0 += FOLD) {
+            int k1 = std::min(m, k0 + FOLD);
+            for (int k = k0; k < k1; k++) {
+                const __m256i be = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(b + k * TILE_W));
+                const __m256i bo = _mm256_srli_epi64(be, 32);
+                const std::uint32_t* ak = a + k * TILE_H;
+                __m256i x0 = _mm256_set1_epi32(int(ak[0]));
+                __m256i x1 = _mm256_set1_epi32(int(ak[1]));
+                __m256i x2 = _mm256_set1_epi32(int(ak[2]));
+                __m256i x3 = _mm256_set1_epi32(int(ak[3]));
+                e0 = _mm256_add_epi64(e0, _mm256_mul_epu32(x0, be));
+                o0 = _mm256_add_epi64(o0, _mm256_mul_epu32(x0, bo));
+                e1 = _mm256_add_epi64(e1, _mm256_mul_epu32(x1, be));
+                o1 = _mm256_add_epi64(o1, _mm256_mul_epu32(x1, bo));
+                e2 = _mm256_add_epi64(e2, _mm256_mul_epu32(x2, be));
+                o2 = _mm256_add_epi64(o2, _mm256_mul_epu32(x2, bo));
+                e3 = _mm256_add_epi64(e3, _mm256_mul_epu32(x3, be));
+                o3 = _mm256_add_epi64(o3, _mm256_mul_epu32(x3, bo));
+            }
+            e0 = fold_avx2(e0), o0 = fold_avx2(o0);
+            e1 = fold_avx2(e1), o1 = fold_avx2(o1);
+            e2 = fold_avx2(e2), o2 = fold_avx2(o2);
+            e3 = fold_avx2(e3), o3 = fold_avx2(o3);
+        }
+        const __m256i e[TILE_H] = {e0, e1, e2, e3};
+        const __m256i o[TILE_H] = {o0, o1, o2, o3};
+        for (int i = 0; i < TILE_H; i++) {
+            alignas(32) std::uint64_t ev[4], ov[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(ev), e[i]);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(ov), o[i]);
+            for (int j = 0; j < 4; j++) {
+                c[i][2 * j] = ev[j];
+                c[i][2 * j + 1] = ov[j];
+            }
+        }
+    }
+
+    __attribute__((target("avx2"))) static void sub_mul_avx2(
+        std::uint32_t* x, const std::uint32_t* y, std::uint32_t cr, int n) {
+        const __m256i mod = _mm256_set1_epi32(int(MOD));
+        const __m256i neg_inv = _mm256_set1_epi32(int(NEG_INV));
+        const __m256i vc = _mm256_set1_epi32(int(cr));
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i vy =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+            __m256i vx =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+            // Montgomery reduction of even and odd lanes in 64 bits
+            __m256i pe = _mm256_mul_epu32(vy, vc);
+            __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(vy, 32), vc);
+            __m256i re = _mm256_add_epi64(
+                pe, _mm256_mul_epu32(_mm256_mul_epu32(pe, neg_inv), mod));
+            __m256i ro = _mm256_add_epi64(
+                po, _mm256_mul_epu32(_mm256_mul_epu32(po, neg_inv), mod));
+            __m256i t = _mm256_blend_epi32(_mm256_srli_epi64(re, 32), ro,
+                                           0b10101010);
+            t = _mm256_min_epu32(t, _mm256_sub_epi32(t, mod));
+            __m256i d = _mm256_sub_epi32(vx, t);
+            d = _mm256_min_epu32(d, _mm256_add_epi32(d, mod));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), d);
+        }
+        sub_mul(x + i, y + i, cr, n - i);
+    }
+#endif
+
+    // c(n x k) = a(n x m) * b(m x k), all row-major
+    // output tiles are split into `threads` bands of rows
+    static void product(const std::uint32_t* a, const std::uint32_t* b,
+                        std::uint32_t* c, int n, int m, int k, int threads) {
+        const int nb = (n + TILE_H - 1) / TILE_H;
+        const int kb = (k + TILE_W - 1) / TILE_W;
+        // zero padded to whole tiles
+        std::vector<std::uint32_t> pa(std::size_t(nb) * m * TILE_H);
+        std::vector<std::uint32_t> pb(std::size_t(kb) * m * TILE_W);
+        for (int i = 0; i < n; i++) {
+            std::uint32_t* p = pa.data() + std::size_t(i / TILE_H) * m * TILE_H +
+                               i % TILE_H;
+            for (int l = 0; l < m; l++) p[l * TILE_H] = a[std::size_t(i) * m + l];
+        }
+        for (int l = 0; l < m; l++) {
+            for (int j = 0; j < k; j++) {
+                pb[(std::size_t(j / TILE_W) * m + l) * TILE_W + j % TILE_W] =
+                    b[std::size_t(l) * k + j];
+            }
+        }
+
+        const bool avx2 = cpu_supports(CpuFeature::avx2);
+        auto run = [&](int ib_begin, int ib_end) {
+            std::uint64_t t[TILE_H][TILE_W];
+            for (int jb0 = 0; jb0 < kb; jb0 += STRIPS) {
+                int jb1 = std::min(kb, jb0 + STRIPS);
+                for (int ib = ib_begin; ib < ib_end; ib++) {
+                    const std::uint32_t* ta =
+                        pa.data() + std::size_t(ib) * m * TILE_H;
+                    for (int jb = jb0; jb < jb1; jb++) {
+                        const std::uint32_t* tb =
+                            pb.data() + std::size_t(jb) * m * TILE_W;
+#if defined(LIBRARY_CHECKER_X86)
+                        if (avx2) {
+                            tile_avx2(ta, tb, m, t);
+                        } else {
+                            tile(ta, tb, m, t);
+                        }
+#else
+                        tile(ta, tb, m, t);
+#endif
+                        int h = std::min(TILE_H, n - ib * TILE_H);
+                        int w = std::min(TILE_W, k - jb * TILE_W);
+                        for (int i = 0; i < h; i++) {
+                            std::uint32_t* row =
+                                c + std::size_t(ib * TILE_H + i) * k +
+                                jb * TILE_W;
+                            for (int j = 0; j < w; j++) {
+                                row[j] = std::uint32_t(t[i][j] % MOD);
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        threads = std::max(1, std::min(threads, nb));
+        if (threads == 1) {
+            run(0, nb);
+            return;
+        }
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back(run, int(std::int64_t(nb) * i / threads),
+                                 int(std::int64_t(nb) * (i + 1) / threads));
+        }
+        for (auto& th : workers) th.join();
+    }
+
+    // x[i] = x[i] - c * y[i] mod MOD for i in [0, n)
+    static void row_sub_mul(std::uint32_t* x, const std::uint32_t* y,
+                            std::uint32_t c, int n) {
+        const std::uint32_t cr = std::uint32_t((std::uint64_t(c) << 32) % MOD);
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::avx2)) {
+            sub_mul_avx2(x, y, cr, n);
+            return;
+        }
+#endif
+        sub_mul(x, y, cr, n);
+    }
+
+    static std::uint32_t pow_mod(std::uint32_t x, std::uint64_t n) {
+        std::uint64_t r = 1 % MOD, y = x;
+        while (n) {
+            if (n & 1) r = r * y % MOD;
+            y = y * y % MOD;
+            n >>= 1;
+        }
+        return std::uint32_t(r);
+    }
+};
+
+template <std::uint32_t MOD>
+Matrix<MOD> multiply(const Matrix<MOD>& a, const Matrix<MOD>& b,
+                     int threads = 1) {
+    assert(a.w == b.h);
+    Matrix<MOD> c(a.h, b.w);
+    MatrixKernel<MOD>::product(a.a.data(), b.a.data(), c.a.data(), a.h, a.w,
+                               b.w, threads);
+    return c;
+}
+
+template <std::uint32_t MOD>
+Matrix<MOD> power(Matrix<MOD> a, std::uint64_t k, int threads = 1) {
+    assert(a.h == a.w);
+    Matrix<MOD> res = Matrix<MOD>::identity(a.h);
+    while (k) {
+        if (k & 1) res = multiply(res, a, threads);
+        k >>= 1;
+        if (k) a = multiply(a, a, threads);
+    }
+    return res;
+}
+
+// Gauss-Jordan elimination, MOD must be a prime
+// returns std::nullopt if a is singular
+template <std::uint32_t MOD>
+std::optional<Matrix<MOD>> inverse(const Matrix<MOD>& a) {
+    using K = MatrixKernel<MOD>;
+    assert(a.h == a.w);
+    const int n = a.h;
+    Matrix<MOD> m(n, 2 * n);
+    for (int i = 0; i < n; i++) {
+        std::copy(a[i], a[i] + n, m[i]);
+        m[i][n + i] = 1 % MOD;
+    }
+    for (int j = 0; j < n; j++) {
+        int p = j;
+        while (p < n && m[p][j] == 0) p++;
+        if (p == n) return std::nullopt;
+        if (p != j) std::swap_ranges(m[p], m[p] + 2 * n, m[j]);
+        std::uint32_t* pivot = m[j];
+        const std::uint64_t inv = K::pow_mod(pivot[j], MOD - 2);
+        for (int l = j; l < 2 * n; l++) {
+            pivot[l] = std::uint32_t(pivot[l] * inv % MOD);
+        }
+        for (int i = 0; i < n; i++) {
+            if (i == j || m[i][j] == 0) continue;
+            K::row_sub_mul(m[i] + j, pivot + j, m[i][j], 2 * n - j);
+        }
+    }
+    Matrix<MOD> b(n, n);
+    for (int i = 0; i < n; i++) std::copy(m[i] + n, m[i] + 2 * n, b[i]);
+    return b;
+}
+
+}  // namespace library_checker
@@ -0,0 +1,512 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_features.h"
+
+namespace library_checker {
+
+namespace ntt_internal {
+
+constexpr std::uint32_t pow_mod_constexpr(std::uint64_t x, std::uint64_t n,
+                                          std::uint32_t m) {
+    std::uint64_t r = 1;
+    x %= m;
+    while (n) {
+        if (n & 1) r = r * x % m;
+        x = x * x % m;
+        n >>= 1;
+    }
+    return std::uint32_t(r);
+}
+
+// smallest primitive root of prime m
+constexpr std::uint32_t primitive_root_constexpr(std::uint32_t m) {
+    if (m == 2) return 1;
+    std::uint32_t divs[32] = {};
+    int cnt = 0;
+    std::uint32_t x = (m - 1) / 2;
+    while (x % 2 == 0) x /= 2;
+    divs[cnt++] = 2;
+    for (std::uint32_t i = 3; std::uint64_t(i) * i <= x; i += 2) {
+        if (x % i == 0) {
+            divs[cnt++] = i;
+            while (x % i == 0) x /= i;
+        }
+    }
+    if (x > 1) divs[cnt++] = x;
+    for (std::uint32_t g = 2;; g++) {
+        bool ok = true;
+        for (int i = 0; i < cnt; i++) {
+            if (pow_mod_constexpr(g, (m - 1) / divs[i], m) == 1) {
+                ok = false;
+                break;
+            }
+        }
+        if (ok) return g;
+    }
+}
+
+}  // namespace ntt_internal
+
+// Number theoretic transform over Z/MOD, MOD is a prime < 2^30.
+//
+// Values are plain integers, not Montgomery form: every twiddle is stored
+// as t * 2^32 mod MOD, so a Montgomery multiplication by it is a plain
+// multiplication by t. Intermediate values are lazily kept in [0, 2 MOD).
+//
+// transform() is a radix-4 DIF whose output is in bit-reversed order and
+// inverse_transform() is the matching DIT taking bit-reversed input, so no
+// bit-reversal permutation is needed between them.
+//
+// On x86 CPUs with AVX2, butterflies of blocks with p >= 8 and pointwise
+// products run on 8 lanes of Montgomery multiplication.
+template <std::uint32_t MOD> struct NTT {
+    static_assert(MOD % 2 == 1 && MOD < (1u << 30));
+
+    static constexpr std::uint32_t G =
+        ntt_internal::primitive_root_constexpr(MOD);
+    static constexpr int RANK2 = __builtin_ctz(MOD - 1);
+
+    // -MOD^{-1} mod 2^32
+    static constexpr std::uint32_t NEG_INV = [] {
+        std::uint32_t x = MOD;
+        for (int i = 0; i < 4; i++) x *= 2 - MOD * x;
+        return -x;
+    }();
+    static constexpr std::uint32_t R2 = std::uint32_t((-std::uint64_t(MOD)) % MOD);  // 2^64 mod MOD
+
+    // x / 2^32 mod MOD, in [0, 2 MOD) if x < 2^32 MOD
+    static std::uint32_t reduce(std::uint64_t x) {
+        return std::uint32_t(
+            (x + std::uint64_t(std::uint32_t(x) * NEG_INV) * MOD) >> 32);
+    }
+    // a * b / 2^32 mod MOD, in [0, 2 MOD) if a < 4 MOD, b < MOD or a, b < 2 MOD
+    static std::uint32_t mul(std::uint32_t a, std::uint32_t b) {
+        return reduce(std::uint64_t(a) * b);
+    }
+    // [0, 4 MOD) -> [0, 2 MOD)
+    static std::uint32_t shrink2(std::uint32_t a) {
+        return a >= 2 * MOD ? a - 2 * MOD : a;
+    }
+    // [0, 2 MOD) -> [0, MOD)
+    static std::uint32_t shrink(std::uint32_t a) {
+        return a >= MOD ? a - MOD : a;
+    }
+    // Montgomery form of a < MOD
+    static std::uint32_t to_mont(std::uint32_t a) { return shrink(mul(a, R2)); }
+
+    struct Info {
+        // rate2[i], rate3[i]: step of the twiddle between adjacent blocks,
+        // where i is the number of trailing ones of the block index
+        std::uint32_t rate2[RANK2], irate2[RANK2];
+        std::uint32_t rate3[RANK2], irate3[RANK2];
+        std::uint32_t imag, iimag;  // 4th roots of unity
+
+        Info() {
+            std::uint32_t root[RANK2 + 1], iroot[RANK2 + 1];
+            root[RANK2] =
+                ntt_internal::pow_mod_constexpr(G, (MOD - 1) >> RANK2, MOD);
+            iroot[RANK2] = ntt_internal::pow_mod_constexpr(root[RANK2], MOD - 2, MOD);
+            for (int i = RANK2 - 1; i >= 0; i--) {
+                root[i] = std::uint32_t(std::uint64_t(root[i + 1]) * root[i + 1] % MOD);
+                iroot[i] = std::uint32_t(std::uint64_t(iroot[i + 1]) * iroot[i + 1] % MOD);
+            }
+            auto mulmod = [](std::uint32_t a, std::uint32_t b) {
+                return std::uint32_t(std::uint64_t(a) * b % MOD);
+            };
+            std::uint32_t prod = 1, iprod = 1;
+            for (int i = 0; i <= RANK2 - 2; i++) {
+                rate2[i] = to_mont(mulmod(root[i + 2], prod));
+                irate2[i] = to_mont(mulmod(iroot[i + 2], iprod));
+                prod = mulmod(prod, iroot[i + 2]);
+                iprod = mulmod(iprod, root[i + 2]);
+            }
+            prod = 1, iprod = 1;
+            for (int i = 0; i <= RANK2 - 3; i++) {
+                rate3[i] = to_mont(mulmod(root[i + 3], prod));
+                irate3[i] = to_mont(mulmod(iroot[i + 3], iprod));
+                prod = mulmod(prod, iroot[i + 3]);
+                iprod = mulmod(iprod, root[i + 3]);
+            }
+            imag = to_mont(root[2]);
+            iimag = to_mont(iroot[2]);
+        }
+    };
+    static const Info& info() {
+        static const Info res;
+        return res;
+    }
+
+    // butterflies of one block, i in [0, p)
+    static void forward2(std::uint32_t* x, int p, std::uint32_t rot) {
+        for (int i = 0; i < p; i++) {
+            std::uint32_t l = x[i];
+            std::uint32_t r = mul(x[i + p], rot);
+            x[i] = shrink2(l + r);
+            x[i + p] = shrink2(l + 2 * MOD - r);
+        }
+    }
+    static void forward4(std::uint32_t* x, int p, std::uint32_t rot,
+                         std::uint32_t rot2, std::uint32_t rot3,
+                         std::uint32_t imag) {
+        for (int i = 0; i < p; i++) {
+            std::uint32_t a0 = x[i];
+            std::uint32_t a1 = mul(x[i + p], rot);
+            std::uint32_t a2 = mul(x[i + 2 * p], rot2);
+            std::uint32_t a3 = mul(x[i + 3 * p], rot3);
+            std::uint32_t t0 = shrink2(a0 + a2);
+            std::uint32_t t1 = shrink2(a0 + 2 * MOD - a2);
+            std::uint32_t t2 = shrink2(a1 + a3);
+            std::uint32_t t3 = mul(a1 + 2 * MOD - a3, imag);
+            x[i] = shrink2(t0 + t2);
+            x[i + p] = shrink2(t0 + 2 * MOD - t2);
+            x[i + 2 * p] = shrink2(t1 + t3);
+            x[i + 3 * p] = shrink2(t1 + 2 * MOD - t3);
+        }
+    }
+    static void inverse2(std::uint32_t* x, int p, std::uint32_t irot) {
+        for (int i = 0; i < p; i++) {
+            std::uint32_t l = x[i];
+            std::uint32_t r = x[i + p];
+            x[i] = shrink2(l + r);
+            x[i + p] = mul(l + 2 * MOD - r, irot);
+        }
+    }
+    static void inverse4(std::uint32_t* x, int p, std::uint32_t irot,
+                         std::uint32_t irot2, std::uint32_t irot3,
+                         std::uint32_t iimag) {
+        for (int i = 0; i < p; i++) {
+            std::uint32_t a0 = x[i], a1 = x[i + p], a2 = x[i + 2 * p],
+                          a3 = x[i + 3 * p];
+            std::uint32_t t0 = shrink2(a0 + a1);
+            std::uint32_t t1 = shrink2(a0 + 2 * MOD - a1);
+            std::uint32_t t2 = shrink2(a2 + a3);
+            std::uint32_t t3 = mul(a2 + 2 * MOD - a3, iimag);
+            x[i] = shrink2(t0 + t2);
+            x[i + p] = mul(t1 + t3, irot);
+            x[i + 2 * p] = mul(t0 + 2 * MOD - t2, irot2);
+            x[i + 3 * p] = mul(t1 + 2 * MOD - t3, irot3);
+        }
+    }
+    static void pointwise(std::uint32_t* a, const std::uint32_t* b, int n) {
+        for (int i = 0; i < n; i++) a[i] = mul(a[i], b[i]);
+    }
+
+#if defined(LIBRARY_CHECKER_X86)
+    // same as above, 8 lanes at once. p must be a multiple of 8
+    __attribute__((target("avx2"))) static __m256i mul_avx2(__m256i a,
+                                                            __m256i b) {
+        const __m256i mod = _mm256_set1_epi32(int(MOD));
+        const __m256i neg_inv = _mm256_set1_epi32(int(NEG_INV));
+        // even lanes and odd lanes separately in 64 bits
+        __m256i prod_even = _mm256_mul_epu32(a, b);
+        __m256i prod_odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32),
+                                            _mm256_srli_epi64(b, 32));
+        __m256i q_even = _mm256_mul_epu32(prod_even, neg_inv);
+        __m256i q_odd = _mm256_mul_epu32(prod_odd, neg_inv);
+        __m256i r_even =
+            _mm256_add_epi64(prod_even, _mm256_mul_epu32(q_even, mod));
+        __m256i r_odd = _mm256_add_epi64(prod_odd, _mm256_mul_epu32(q_odd, mod));
+        return _mm256_blend_epi32(_mm256_srli_epi64(r_even, 32), r_odd,
+                                  0b10101010);
+    }
+    __attribute__((target("avx2"))) static __m256i shrink2_avx2(__m256i a) {
+        const __m256i mod2 = _mm256_set1_epi32(int(2 * MOD));
+        return _mm256_min_epu32(a, _mm256_sub_epi32(a, mod2));
+    }
+    __attribute__((target("avx2"))) static __m256i load(const std::uint32_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    __attribute__((target("avx2"))) static void store(std::uint32_t* p,
+                                                      __m256i a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+    }
+
+    __attribute__((target("avx2"))) static void forward4_avx2(
+        std::uint32_t* x, int p, std::uint32_t rot, std::uint32_t rot2,
+        std::uint32_t rot3, std::uint32_t imag) {
+        const __m256i mod2 = _mm256_set1_epi32(int(2 * MOD));
+        const __m256i vrot = _mm256_set1_epi32(int(rot));
+        const __m256i vrot2 = _mm256_set1_epi32(int(rot2));
+        const __m256i vrot3 = _mm256_set1_epi32(int(rot3));
+        const __m256i vimag = _mm256_set1_epi32(int(imag));
+        for (int i = 0; i < p; i += 8) {
+            __m256i a0 = load(x + i);
+            __m256i a1 = mul_avx2(load(x + i + p), vrot);
+            __m256i a2 = mul_avx2(load(x + i + 2 * p), vrot2);
+            __m256i a3 = mul_avx2(load(x + i + 3 * p), vrot3);
+            __m256i t0 = shrink2_avx2(_mm256_add_epi32(a0, a2));
+            __m256i t1 = shrink2_avx2(
+                _mm256_sub_epi32(_mm256_add_epi32(a0, mod2), a2));
+            __m256i t2 = shrink2_avx2(_mm256_add_epi32(a1, a3));
+            __m256i t3 = mul_avx2(
+                _mm256_sub_epi32(_mm256_add_epi32(a1, mod2), a3), vimag);
+            store(x + i, shrink2_avx2(_mm256_add_epi32(t0, t2)));
+            store(x + i + p, shrink2_avx2(_mm256_sub_epi32(
+                                 _mm256_add_epi32(t0, mod2), t2)));
+            store(x + i + 2 * p, shrink2_avx2(_mm256_add_epi32(t1, t3)));
+            store(x + i + 3 * p, shrink2_avx2(_mm256_sub_epi32(
+                                     _mm256_add_epi32(t1, mod2), t3)));
+        }
+    }
+    __attribute__((target("avx2"))) static void inverse2_avx2(
+        std::uint32_t* x, int p, std::uint32_t irot) {
+        const __m256i mod2 = _mm256_set1_epi32(int(2 * MOD));
+        const __m256i virot = _mm256_set1_epi32(int(irot));
+        for (int i = 0; i < p; i += 8) {
+            __m256i l = load(x + i), r = load(x + i + p);
+            store(x + i, shrink2_avx2(_mm256_add_epi32(l, r)));
+            store(x + i + p,
+                  mul_avx2(_mm256_sub_epi32(_mm256_add_epi32(l, mod2), r),
+                           virot));
+        }
+    }
+    __attribute__((target("avx2"))) static void inverse4_avx2(
+        std::uint32_t* x, int p, std::uint32_t irot, std::uint32_t irot2,
+        std::uint32_t irot3, std::uint32_t iimag) {
+        const __m256i mod2 = _mm256_set1_epi32(int(2 * MOD));
+        const __m256i virot = _mm256_set1_epi32(int(irot));
+        const __m256i virot2 = _mm256_set1_epi32(int(irot2));
+        const __m256i virot3 = _mm256_set1_epi32(int(irot3));
+        const __m256i viimag = _mm256_set1_epi32(int(iimag));
+        for (int i = 0; i < p; i += 8) {
+            __m256i a0 = load(x + i), a1 = load(x + i + p),
+                    a2 = load(x + i + 2 * p), a3 = load(x + i + 3 * p);
+            __m256i t0 = shrink2_avx2(_mm256_add_epi32(a0, a1));
+            __m256i t1 = shrink2_avx2(
+                _mm256_sub_epi32(_mm256_add_epi32(a0, mod2), a1));
+            __m256i t2 = shrink2_avx2(_mm256_add_epi32(a2, a3));
+            __m256i t3 = mul_avx2(
+                _mm256_sub_epi32(_mm256_add_epi32(a2, mod2), a3), viimag);
+            store(x + i, shrink2_avx2(_mm256_add_epi32(t0, t2)));
+            store(x + i + p, mul_avx2(_mm256_add_epi32(t1, t3), virot));
+            store(x + i + 2 * p,
+                  mul_avx2(_mm256_sub_epi32(_mm256_add_epi32(t0, mod2), t2),
+                           virot2));
+            store(x + i + 3 * p,
+                  mul_avx2(_mm256_sub_epi32(_mm256_add_epi32(t1, mod2), t3),
+                           virot3));
+        }
+    }
+    __attribute__((target("avx2"))) static void pointwise_avx2(
+        std::uint32_t* a, const std::uint32_t* b, int n) {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) store(a + i, mul_avx2(load(a + i), load(b + i)));
+        for (; i < n; i++) a[i] = mul(a[i], b[i]);
+    }
+#endif
+
+    // a[0..n) -> DFT of a in bit-reversed order, n = 2^k
+    // input in [0, 2 MOD), output in [0, 2 MOD)
+    static void transform_lazy(std::uint32_t* a, int n) {
+        const Info& inf = info();
+        int h = __builtin_ctz(n);
+        assert(n == (1 << h) && h <= RANK2);
+        [[maybe_unused]] const bool avx2 = cpu_supports(CpuFeature::avx2);
+        const std::uint32_t one = to_mont(1);
+        int len = 0;
+        while (len < h) {
+            if (h - len == 1) {
+                // the last stage, p = 1
+                int p = 1 << (h - len - 1);
+                std::uint32_t rot = one;
+                for (int s = 0; s < (1 << len); s++) {
+                    forward2(a + (s << (h - len)), p, rot);
+                    if (s + 1 != (1 << len)) {
+                        rot = shrink(mul(rot, inf.rate2[__builtin_ctz(~(unsigned int)s)]));
+                    }
+                }
+                len++;
+            } else {
+                int p = 1 << (h - len - 2);
+                std::uint32_t rot = one;
+                for (int s = 0; s < (1 << len); s++) {
+                    std::uint32_t rot2 = shrink(mul(rot, rot));
+                    std::uint32_t rot3 = shrink(mul(rot2, rot));
+                    std::uint32_t* x = a + (s << (h - len));
+#if defined(LIBRARY_CHECKER_X86)
+                    if (avx2 && p >= 8) {
+                        forward4_avx2(x, p, rot, rot2, rot3, inf.imag);
+                    } else {
+                        forward4(x, p, rot, rot2, rot3, inf.imag);
+                    }
+#else
+                    forward4(x, p, rot, rot2, rot3, inf.imag);
+#endif
+                    if (s + 1 != (1 << len)) {
+                        rot = shrink(mul(rot, inf.rate3[__builtin_ctz(~(unsigned int)s)]));
+                    }
+                }
+                len += 2;
+            }
+        }
+    }
+
+    // inverse of transform_lazy, without the division by n
+    static void inverse_transform_lazy(std::uint32_t* a, int n) {
+        const Info& inf = info();
+        int h = __builtin_ctz(n);
+        assert(n == (1 << h) && h <= RANK2);
+        [[maybe_unused]] const bool avx2 = cpu_supports(CpuFeature::avx2);
+        const std::uint32_t one = to_mont(1);
+        int len = h;
+        while (len) {
+            if (len == 1) {
+                int p = 1 << (h - len);
+                std::uint32_t irot = one;
+                for (int s = 0; s < (1 << (len - 1)); s++) {
+                    std::uint32_t* x = a + (s << (h - len + 1));
+#if defined(LIBRARY_CHECKER_X86)
+                    if (avx2 && p >= 8) {
+                        inverse2_avx2(x, p, irot);
+                    } else {
+                        inverse2(x, p, irot);
+                    }
+#else
+                    inverse2(x, p, irot);
+#endif
+                    if (s + 1 != (1 << (len - 1))) {
+                        irot = shrink(mul(irot, inf.irate2[__builtin_ctz(~(unsigned int)s)]));
+                    }
+                }
+                len--;
+            } else {
+                int p = 1 << (h - len);
+                std::uint32_t irot = one;
+                for (int s = 0; s < (1 << (len - 2)); s++) {
+                    std::uint32_t irot2 = shrink(mul(irot, irot));
+                    std::uint32_t irot3 = shrink(mul(irot2, irot));
+                    std::uint32_t* x = a + (s << (h - len + 2));
+#if defined(LIBRARY_CHECKER_X86)
+                    if (avx2 && p >= 8) {
+                        inverse4_avx2(x, p, irot, irot2, irot3, inf.iimag);
+                    } else {
+                        inverse4(x, p, irot, irot2, irot3, inf.iimag);
+                    }
+#else
+                    inverse4(x, p, irot, irot2, irot3, inf.iimag);
+#endif
+                    if (s + 1 != (1 << (len - 2))) {
+                        irot = shrink(mul(irot, inf.irate3[__builtin_ctz(~(unsigned int)s)]));
+                    }
+                }
+                len -= 2;
+            }
+        }
+    }
+
+    // a[0..n) in [0, MOD) -> DFT of a in bit-reversed order, in [0, MOD)
+    static void transform(std::uint32_t* a, int n) {
+        transform_lazy(a, n);
+        for (int i = 0; i < n; i++) a[i] = shrink(a[i]);
+    }
+    // inverse of transform, in [0, MOD). the result is multiplied by n
+    static void inverse_transform(std::uint32_t* a, int n) {
+        inverse_transform_lazy(a, n);
+        for (int i = 0; i < n; i++) a[i] = shrink(a[i]);
+    }
+
+    // a <- a * b mod (x^n - 1), n = 2^k, b is broken
+    static void cyclic_multiply(std::uint32_t* a, std::uint32_t* b, int n) {
+        transform_lazy(a, n);
+        transform_lazy(b, n);
+        // pointwise product divides by 2^32, fold it into 1/n
+        std::uint32_t scale = std::uint32_t(
+            std::uint64_t(ntt_internal::pow_mod_constexpr(n, MOD - 2, MOD)) * R2 % MOD);
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::avx2)) {
+            pointwise_avx2(a, b, n);
+        } else {
+            pointwise(a, b, n);
+        }
+#else
+        pointwise(a, b, n);
+#endif
+        inverse_transform_lazy(a, n);
+        for (int i = 0; i < n; i++) a[i] = shrink(mul(a[i], scale));
+    }
+
+    static std::vector<std::uint32_t> multiply_naive(
+        const std::vector<std::uint32_t>& a,
+        const std::vector<std::uint32_t>& b) {
+        if (a.size() > b.size()) return multiply_naive(b, a);
+        std::vector<std::uint64_t> c(a.size() + b.size() - 1);
+        // sum of up to 16 products of (MOD - 1)^2 < 2^60 fits in 64 bits
+        for (size_t i = 0; i < a.size(); i++) {
+            for (size_t j = 0; j < b.size(); j++) {
+                c[i + j] += std::uint64_t(a[i]) * b[j];
+            }
+            if (i % 16 == 15) {
+                for (auto& x : c) x %= MOD;
+            }
+        }
+        std::vector<std::uint32_t> res(c.size());
+        for (size_t i = 0; i < c.size(); i++) res[i] = std::uint32_t(c[i] % MOD);
+        return res;
+    }
+
+    // c[k] = sum_{i + j = k} a[i] b[j], a[i], b[j] in [0, MOD)
+    static std::vector<std::uint32_t> multiply(
+        const std::vector<std::uint32_t>& a,
+        const std::vector<std::uint32_t>& b) {
+        if (a.empty() || b.empty()) return {};
+        if (std::min(a.size(), b.size()) <= 32) return multiply_naive(a, b);
+        int len = int(a.size() + b.size() - 1);
+        int z = 1;
+        while (z < len) z *= 2;
+        std::vector<std::uint32_t> a2(z), b2(z);
+        std::copy(a.begin(), a.end(), a2.begin());
+        std::copy(b.begin(), b.end(), b2.begin());
+        cyclic_multiply(a2.data(), b2.data(), z);
+        a2.resize(len);
+        return a2;
+    }
+
+    // c[i] = sum_j a[i + j] b[j] for 0 <= i <= |a| - |b|, |a| >= |b| >= 1
+    static std::vector<std::uint32_t> middle_product(
+        const std::vector<std::uint32_t>& a,
+        const std::vector<std::uint32_t>& b) {
+        int n = int(a.size()), m = int(b.size());
+        assert(n >= m && m >= 1);
+        // (a * rev(b))[m - 1 + i] = c[i], wrap around of size >= n never reaches there
+        int z = 1;
+        while (z < n) z *= 2;
+        std::vector<std::uint32_t> a2(z), b2(z);
+        std::copy(a.begin(), a.end(), a2.begin());
+        std::copy(b.rbegin(), b.rend(), b2.begin());
+        cyclic_multiply(a2.data(), b2.data(), z);
+        return {a2.begin() + (m - 1), a2.begin() + n};
+    }
+};
+
+template <std::uint32_t MOD>
+std::vector<std::uint32_t> multiply(const std::vector<std::uint32_t>& a,
+                                    const std::vector<std::uint32_t>& b) {
+    return NTT<MOD>::multiply(a, b);
+}
+
+// multiply() for a modint type T that keeps its value in [0, MOD) in the
+// unsigned member v, like the ModInt of the solutions
+template <std::uint32_t MOD, class T, std::enable_if_t<!std::is_integral_v<T>>* = nullptr>
+std::vector<T> multiply(const std::vector<T>& a, const std::vector<T>& b) {
+    std::vector<std::uint32_t> a2(a.size()), b2(b.size());
+    for (size_t i = 0; i < a.size(); i++) a2[i] = a[i].v;
+    for (size_t i = 0; i < b.size(); i++) b2[i] = b[i].v;
+    auto c = NTT<MOD>::multiply(a2, b2);
+    std::vector<T> res(c.size());
+    for (size_t i = 0; i < c.size(); i++) res[i].v = c[i];
+    return res;
+}
+
+template <std::uint32_t MOD>
+std::vector<std::uint32_t> middle_product(const std::vector<std::uint32_t>& a,
+                                          const std::vector<std::uint32_t>& b) {
+    return NTT<MOD>::middle_product(a, b);
+}
+
+}  // namespace library_checker
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace library_checker {
+
+// Fenwick tree of prefix sums on one flat array.
+// T is an abelian group: T() is zero, and += and -= are defined.
+template <class T> struct FlatFenwick {
+    FlatFenwick() = default;
+    explicit FlatFenwick(int n_) : n(n_), d(n_ + 1) {}
+
+    void add(int i, const T& x) {
+        for (i++; i <= n; i += i & -i) d[i] += x;
+    }
+    void sub(int i, const T& x) {
+        for (i++; i <= n; i += i & -i) d[i] -= x;
+    }
+    // sum of [0, i)
+    T sum(int i) const {
+        T s = T();
+        for (; i > 0; i -= i & -i) s += d[i];
+        return s;
+    }
+    // sum of [l, r)
+    T sum(int l, int r) const {
+        T s = sum(r);
+        s -= sum(l);
+        return s;
+    }
+
+  private:
+    int n = 0;
+    std::vector<T> d;
+};
+
+namespace rectangle_sum_internal {
+
+// ranks of sorted unique keys; rank(x) = number of keys less than x
+struct Compressor {
+    std::vector<std::int64_t> keys;
+
+    void build() {
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+    int size() const { return int(keys.size()); }
+    int rank(std::int64_t x) const {
+        return int(std::lower_bound(keys.begin(), keys.end(), x) - keys.begin());
+    }
+};
+
+}  // namespace rectangle_sum_internal
+
+// Sums of weighted points in rectangles [l, r) x [d, u), offline.
+//
+// All the points come before all the queries. solve() compresses y once,
+// splits every query into the prefixes x < r and x < l, and sweeps x with
+// a FlatFenwick over y: O((N + Q) log N).
+template <class T> struct StaticRectangleSum {
+    void add_point(std::int64_t x, std::int64_t y, const T& w) {
+        px.push_back(x);
+        py.push_back(y);
+        pw.push_back(w);
+    }
+    void add_query(std::int64_t l, std::int64_t d, std::int64_t r, std::int64_t u) {
+        assert(l <= r && d <= u);
+        queries.push_back({l, d, r, u});
+    }
+
+    std::vector<T> solve() const {
+        int n = int(px.size()), q = int(queries.size());
+        std::vector<T> res(q);
+        rectangle_sum_internal::Compressor ys;
+        ys.keys = py;
+        ys.build();
+
+        std::vector<int> points(n);
+        std::iota(points.begin(), points.end(), 0);
+        std::sort(points.begin(), points.end(),
+                  [&](int i, int j) { return px[i] < px[j]; });
+        // query i is the prefix x < r if even, x < l if odd
+        std::vector<int> events(2 * q);
+        std::iota(events.begin(), events.end(), 0);
+        auto event_x = [&](int e) {
+            return e & 1 ? queries[e >> 1].l : queries[e >> 1].r;
+        };
+        std::sort(events.begin(), events.end(),
+                  [&](int a, int b) { return event_x(a) < event_x(b); });
+        std::vector<int> yl(q), yr(q);
+        for (int i = 0; i < q; i++) {
+            yl[i] = ys.rank(queries[i].d);
+            yr[i] = ys.rank(queries[i].u);
+        }
+
+        FlatFenwick<T> fw(ys.size());
+        int p = 0;
+        for (int e : events) {
+            std::int64_t x = event_x(e);
+            for (; p < n && px[points[p]] < x; p++) {
+                fw.add(ys.rank(py[points[p]]), pw[points[p]]);
+            }
+            int i = e >> 1;
+            if (e & 1) {
+                res[i] -= fw.sum(yl[i], yr[i]);
+            } else {
+                res[i] += fw.sum(yl[i], yr[i]);
+            }
+        }
+        return res;
+    }
+
+  private:
+    struct Query {
+        std::int64_t l, d, r, u;
+    };
+    std::vector<std::int64_t> px, py;
+    std::vector<T> pw;
+    std::vector<Query> queries;
+};
+
+// Sums of weighted points in rectangles [l, r) x [d, u), where points and
+// queries are interleaved in time, offline.
+//
+// The points added before the first query are answered by a static sweep.
+// The rest is CDQ divide and conquer over time: each level merges the two
+// halves by x, adds the points of the left half to a FlatFenwick over y,
+// answers the queries of the right half, and removes the points again.
+// Events are 16-byte records of ranks, with the weights kept aside, so
+// every level is a sequential pass. O(N log N + Q log Q log N).
+template <class T> struct PointAddRectangleSum {
+    void add_point(std::int64_t x, std::int64_t y, const T& w) {
+        ops.push_back({x, y, 0, 0, int(weights.size())});
+        weights.push_back(w);
+    }
+    void add_query(std::int64_t l, std::int64_t d, std::int64_t r, std::int64_t u) {
+        assert(l <= r && d <= u);
+        ops.push_back({l, d, r, u, -1 - query_count++});
+    }
+
+    std::vector<T> solve() const {
+        std::vector<T> res(query_count);
+        std::size_t first = 0;
+        while (first < ops.size() && ops[first].id >= 0) first++;
+        {
+            StaticRectangleSum<T> st;
+            for (std::size_t i = 0; i < first; i++) {
+                st.add_point(ops[i].x, ops[i].y, weights[ops[i].id]);
+            }
+            for (std::size_t i = first; i < ops.size(); i++) {
+                if (ops[i].id < 0) st.add_query(ops[i].x, ops[i].y, ops[i].r, ops[i].u);
+            }
+            res = st.solve();
+        }
+
+        rectangle_sum_internal::Compressor xs, ys;
+        for (std::size_t i = first; i < ops.size(); i++) {
+            const Op& o = ops[i];
+            xs.keys.push_back(o.x);
+            ys.keys.push_back(o.y);
+            if (o.id < 0) xs.keys.push_back(o.r);
+        }
+        xs.build();
+        ys.build();
+
+        // a query becomes the prefixes x < r (+) and x < l (-)
+        std::vector<Event> ev;
+        for (std::size_t i = first; i < ops.size(); i++) {
+            const Op& o = ops[i];
+            if (o.id >= 0) {
+                ev.push_back({xs.rank(o.x), ys.rank(o.y), 0, o.id});
+            } else {
+                int q = -1 - o.id;
+                int d = ys.rank(o.y), u = ys.rank(o.u);
+                ev.push_back({xs.rank(o.r), d, u, -1 - 2 * q});
+                ev.push_back({xs.rank(o.x), d, u, -2 - 2 * q});
+            }
+        }
+        std::vector<Event> buf(ev.size());
+        FlatFenwick<T> fw(ys.size());
+        cdq(ev.data(), buf.data(), int(ev.size()), fw, res);
+        return res;
+    }
+
+  private:
+    struct Op {
+        std::int64_t x, y, r, u;
+        int id;  // point: index of the weight, query: -1 - index
+    };
+    struct Event {
+        int x;
+        int y, u;  // point: y, query: [y, u)
+        int id;    // point: index of the weight, query: -1 - (2 q + (x is l))
+        bool is_point() const { return id >= 0; }
+        // at the same x, queries (x < X) come before points
+        bool operator<(const Event& e) const {
+            return x != e.x ? x < e.x : !is_point() && e.is_point();
+        }
+    };
+    std::vector<Op> ops;
+    std::vector<T> weights;
+    int query_count = 0;
+
+    // ev[0, n) in time order -> sorted by (x, queries first)
+    void cdq(Event* ev, Event* buf, int n, FlatFenwick<T>& fw, std::vector<T>& res) const {
+        if (n <= 1) return;
+        int m = n / 2;
+        cdq(ev, buf, m, fw, res);
+        cdq(ev + m, buf, n - m, fw, res);
+        int i = 0, j = m, k = 0;
+        while (i < m || j < n) {
+            if (j == n || (i < m && !(ev[j] < ev[i]))) {
+                if (ev[i].is_point()) fw.add(ev[i].y, weights[ev[i].id]);
+                buf[k++] = ev[i++];
+            } else {
+                const Event& e = ev[j];
+                if (!e.is_point()) {
+                    int id = -1 - e.id;
+                    if (id & 1) {
+                        res[id >> 1] -= fw.sum(e.y, e.u);
+                    } else {
+                        res[id >> 1] += fw.sum(e.y, e.u);
+                    }
+                }
+                buf[k++] = ev[j++];
+            }
+        }
+        for (int t = 0; t < m; t++) {
+            if (ev[t].is_point()) fw.sub(ev[t].y, weights[ev[t].id]);
+        }
+        std::copy(buf, buf + n, ev);
+    }
+};
+
+}  // namespace library_checker
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace library_checker {
+
+// Static range minimum query, <O(n), O(1)>.
+//
+// The array is split into blocks of 64. Inside a block, in_block[i] is the
+// set of positions j <= i of the block that were still on the monotone
+// stack after pushing i, i.e. comp(a[k], a[j]) is false for every k in
+// (j, i]. The minimum of [l, i] in a block is then the lowest such j >= l,
+// one mask and one ctz. The minima of whole blocks go to a sparse table,
+// which at n / 64 entries per level is small enough to stay in cache.
+//
+// argmin() returns the leftmost position of a minimum.
+template <class T, class Compare = std::less<T>> struct RMQ {
+    RMQ() = default;
+    explicit RMQ(std::vector<T> a_, Compare comp_ = Compare())
+        : n(int(a_.size())), comp(comp_), a(std::move(a_)), in_block(n) {
+        int nb = (n + B - 1) / B;
+        lg = 1;
+        while ((1 << lg) < nb) lg++;
+        table.resize(std::size_t(lg) * nb);
+        for (int b = 0; b < nb; b++) {
+            int start = b * B, end = std::min(n, start + B);
+            std::uint64_t st = 0;
+            for (int i = start; i < end; i++) {
+                while (st && comp(a[i], a[start + top(st)])) st &= ~(std::uint64_t(1) << top(st));
+                st |= std::uint64_t(1) << (i - start);
+                in_block[i] = st;
+            }
+            table[b] = start + __builtin_ctzll(st);
+        }
+        for (int k = 1; k < lg; k++) {
+            int* cur = table.data() + std::size_t(k) * nb;
+            const int* prev = cur - nb;
+            for (int b = 0; b + (1 << k) <= nb; b++) {
+                cur[b] = better(prev[b], prev[b + (1 << (k - 1))]);
+            }
+        }
+    }
+
+    int size() const { return n; }
+
+    // leftmost position of a minimum of [l, r), l < r
+    int argmin(int l, int r) const {
+        assert(0 <= l && l < r && r <= n);
+        r--;
+        int bl = l / B, br = r / B;
+        if (bl == br) return in_block_argmin(l, r);
+        int res = in_block_argmin(l, bl * B + B - 1);
+        if (bl + 1 < br) res = better(res, blocks_argmin(bl + 1, br));
+        return better(res, in_block_argmin(br * B, r));
+    }
+    const T& min(int l, int r) const { return a[argmin(l, r)]; }
+
+    // argmin(l, r) of each query, in the order of the queries.
+    //
+    // The in-block masks of the query PREFETCH ahead are loaded while the
+    // current one is answered, which overlaps their cache misses.
+    std::vector<int> argmin_batch(const std::vector<std::pair<int, int>>& queries) const {
+        std::size_t q = queries.size();
+        std::vector<int> res(q);
+        for (std::size_t i = 0; i < q; i++) {
+            if (i + PREFETCH < q) {
+                auto [l, r] = queries[i + PREFETCH];
+                __builtin_prefetch(in_block.data() + l);
+                __builtin_prefetch(in_block.data() + (r - 1));
+            }
+            res[i] = argmin(queries[i].first, queries[i].second);
+        }
+        return res;
+    }
+
+  private:
+    static constexpr int B = 64;
+    static constexpr std::size_t PREFETCH = 16;
+
+    int n = 0, lg = 0;
+    Compare comp;
+    std::vector<T> a;
+    std::vector<std::uint64_t> in_block;
+    // level k is the argmin of blocks [b, b + 2^k), lg levels of n / B
+    std::vector<int> table;
+
+    static int top(std::uint64_t st) { return 63 - __builtin_clzll(st); }
+
+    // the leftmost of i and j if a[i] == a[j]
+    int better(int i, int j) const {
+        if (comp(a[j], a[i])) return j;
+        if (comp(a[i], a[j])) return i;
+        return i < j ? i : j;
+    }
+
+    // [l, r] in one block
+    int in_block_argmin(int l, int r) const {
+        std::uint64_t m = in_block[r] >> (l % B) << (l % B);
+        return l / B * B + __builtin_ctzll(m);
+    }
+    // blocks [bl, br)
+    int blocks_argmin(int bl, int br) const {
+        int nb = (n + B - 1) / B;
+        int k = 31 - __builtin_clz(unsigned(br - bl));
+        const int* row = table.data() + std::size_t(k) * nb;
+        return better(row[bl], row[br - (1 << k)]);
+    }
+};
+
+}  // namespace library_checker
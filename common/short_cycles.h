@@ -0,0 +1,395 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cpu_features.h"
+#include "graph.h"
+
+namespace library_checker {
+
+// Simple graph with the vertices relabeled by their rank in the order of
+// (degree, vertex).
+//
+// The edges between ranks are an undirected CSRGraph whose arcs are sorted
+// by the rank of the head, so the lower neighbors of a rank come first.
+// Oriented upwards, a rank of out-degree d has d neighbors of degree >= d,
+// so every out-degree is at most sqrt(2m).
+struct DegreeOrderedGraph {
+    // the vertex of each rank, and the rank of each vertex
+    std::vector<int> vertex, rank;
+    // arc id i is the edge of input index edge[i]
+    std::vector<int> edge;
+
+    DegreeOrderedGraph() = default;
+    DegreeOrderedGraph(int n, const std::vector<std::pair<int, int>>& edges)
+        : vertex(n), rank(n), edge(edges.size()), num_lower(n, 0) {
+        int m = int(edges.size());
+        std::vector<int> deg(n, 0);
+        for (auto [u, v] : edges) {
+            assert(0 <= u && u < n && 0 <= v && v < n && u != v);
+            deg[u]++;
+            deg[v]++;
+        }
+        // counting sort by degree, stable in the vertex
+        std::vector<int> cnt(m + 2, 0);
+        for (int v = 0; v < n; v++) cnt[deg[v] + 1]++;
+        for (int d = 0; d <= m; d++) cnt[d + 1] += cnt[d];
+        for (int v = 0; v < n; v++) {
+            rank[v] = cnt[deg[v]]++;
+            vertex[rank[v]] = v;
+        }
+
+        // edges by (higher rank, lower rank): two counting sorts. Then the
+        // arcs of r are its lower neighbors in increasing order, followed
+        // by the higher ones in increasing order, as CSRGraph keeps the
+        // order of the edges.
+        std::vector<std::pair<int, int>> ranked(m);
+        for (int i = 0; i < m; i++) {
+            int a = rank[edges[i].first], b = rank[edges[i].second];
+            ranked[i] = {std::max(a, b), std::min(a, b)};
+        }
+        std::vector<int> tmp(m), pos(n + 1);
+        auto pass = [&](const std::vector<int>& from, std::vector<int>& to, bool by_high) {
+            std::fill(pos.begin(), pos.end(), 0);
+            for (int i : from) {
+                pos[(by_high ? ranked[i].first : ranked[i].second) + 1]++;
+            }
+            for (int r = 0; r < n; r++) pos[r + 1] += pos[r];
+            for (int i : from) to[pos[by_high ? ranked[i].first : ranked[i].second]++] = i;
+        };
+        std::vector<int> ids(m);
+        for (int i = 0; i < m; i++) ids[i] = i;
+        pass(ids, tmp, false);
+        pass(tmp, edge, true);
+
+        std::vector<std::pair<int, int>> sorted(m);
+        for (int i = 0; i < m; i++) {
+            sorted[i] = ranked[edge[i]];
+            num_lower[sorted[i].first]++;
+        }
+        g = CSRGraph::undirected(n, sorted);
+    }
+
+    int size() const { return g.size(); }
+    int num_edges() const { return g.num_arcs() / 2; }
+    int degree(int r) const { return g[r].size(); }
+    // arcs of r, sorted by the rank
+    CSRGraph::Range operator[](int r) const { return g[r]; }
+    // arcs of r to lower ranks, and to higher ranks, sorted by the rank
+    CSRGraph::Range lower(int r) const {
+        auto all = g[r];
+        return {all.begin(), all.begin() + num_lower[r]};
+    }
+    CSRGraph::Range higher(int r) const {
+        auto all = g[r];
+        return {all.begin() + num_lower[r], all.end()};
+    }
+
+  private:
+    CSRGraph g;
+    std::vector<int> num_lower;
+};
+
+namespace internal {
+
+// f(from, to, worker) on the ranks [0, n) in chunks taken by `threads`
+// workers, so that a few expensive ranks do not hold up one worker
+template <class F> void parallel_ranks(int n, int threads, F f) {
+    constexpr int CHUNK = 64;
+    threads = std::max(1, std::min(threads, (n + CHUNK - 1) / CHUNK));
+    if (threads == 1) {
+        f(0, n, 0);
+        return;
+    }
+    std::atomic<int> next{0};
+    auto run = [&](int worker) {
+        while (true) {
+            int from = next.fetch_add(CHUNK);
+            if (from >= n) break;
+            f(from, std::min(from + CHUNK, n), worker);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) workers.emplace_back(run, i);
+    for (auto& th : workers) th.join();
+}
+
+}  // namespace internal
+
+// Triangles of a simple graph.
+//
+// A triangle is found once, from its lowest rank a, as a -> b -> c with
+// a < b < c on the arcs oriented upwards. The common higher neighbors c of
+// a and b are found in one of three ways:
+//
+// - both light: the higher neighbors of a are marked in a byte array and
+//   those of b are tested, O(out-degree) per arc.
+// - a light, b heavy: the higher neighbors of a after b are tested in the
+//   bitset row of b.
+// - both heavy: the rows of a and b are and-ed word by word.
+//
+// A rank is heavy if its degree is positive and at least sqrt(m). The
+// heavy ranks are a suffix of at most 2 sqrt(m) ranks, closed under going
+// up, so a row is a bitset over that suffix of at most 2 sqrt(m) / 64
+// words: 18 words at m = 3 * 10^5, and the dense core of a graph is
+// counted 64 pairs at a time.
+//
+// The ranks a are split among `threads` workers, each with its own marks
+// and its own accumulator.
+struct TriangleCounter {
+    explicit TriangleCounter(DegreeOrderedGraph g_) : g(std::move(g_)) {
+        int n = g.size();
+        long long m = g.num_edges();
+        heavy = n;
+        while (heavy > 0) {
+            long long d = g.degree(heavy - 1);
+            if (d == 0 || d * d < m) break;
+            heavy--;
+        }
+        words = (n - heavy + 63) / 64;
+        rows.assign(std::size_t(n - heavy) * words, 0);
+        for (int r = heavy; r < n; r++) {
+            std::uint64_t* row = rows.data() + std::size_t(r - heavy) * words;
+            for (auto a : g.higher(r)) {
+                int c = a.to - heavy;
+                row[c / 64] |= std::uint64_t(1) << (c % 64);
+            }
+        }
+    }
+    TriangleCounter(int n, const std::vector<std::pair<int, int>>& edges)
+        : TriangleCounter(DegreeOrderedGraph(n, edges)) {}
+
+    // the number of triangles
+    std::uint64_t count(int threads = 1) const {
+        std::vector<std::uint64_t> res(std::max(threads, 1), 0);
+        internal::parallel_ranks(g.size(), threads, [&](int from, int to, int worker) {
+#if defined(LIBRARY_CHECKER_X86)
+            if (cpu_supports(CpuFeature::popcnt)) {
+                res[worker] += count_popcnt(from, to);
+                return;
+            }
+#endif
+            res[worker] += count_impl(from, to);
+        });
+        std::uint64_t sum = 0;
+        for (auto x : res) sum += x;
+        return sum;
+    }
+
+    // sum of x[a] x[b] x[c] over the triangles {a, b, c} mod MOD, x by the
+    // vertex, x[v] < MOD < 2^32.
+    //
+    // For each arc a -> b the x[c] are added up in 64 bits, and the products
+    // with x[b] in 128 bits, reduced once per a: the only divisions are
+    // one per rank.
+    std::uint32_t weighted_sum(const std::vector<std::uint32_t>& x, std::uint32_t mod,
+                               int threads = 1) const {
+        int n = g.size();
+        assert(int(x.size()) == n);
+        std::vector<std::uint32_t> w(n);
+        for (int r = 0; r < n; r++) w[r] = x[g.vertex[r]];
+        std::vector<std::uint64_t> res(std::max(threads, 1), 0);
+        internal::parallel_ranks(n, threads, [&](int from, int to, int worker) {
+            std::vector<char> mark(n, false);
+            unsigned __int128 acc = 0;
+            for (int a = from; a < to; a++) {
+                unsigned __int128 inner = 0;
+                auto up = g.higher(a);
+                for (auto c : up) mark[c.to] = true;
+                for (auto b = up.begin(); b != up.end(); b++) {
+                    std::uint64_t s = common<true>(a, b, up.end(), mark.data(), w.data());
+                    inner += (unsigned __int128)(w[b->to]) * s;
+                }
+                for (auto c : up) mark[c.to] = false;
+                acc += (unsigned __int128)(std::uint64_t(inner % mod)) * w[a];
+            }
+            res[worker] = (res[worker] + std::uint64_t(acc % mod)) % mod;
+        });
+        std::uint64_t sum = 0;
+        for (auto v : res) sum = (sum + v) % mod;
+        return std::uint32_t(sum);
+    }
+
+  private:
+    DegreeOrderedGraph g;
+    // the first heavy rank
+    int heavy;
+    int words;
+    // bitset of the higher neighbors of each heavy rank, over the heavy ranks
+    std::vector<std::uint64_t> rows;
+
+    const std::uint64_t* row(int r) const {
+        return rows.data() + std::size_t(r - heavy) * words;
+    }
+    bool test(int r, int c) const {
+        c -= heavy;
+        return row(r)[c / 64] >> (c % 64) & 1;
+    }
+
+    // the number (WEIGHTED = false) or the sum of w[c] over the common
+    // higher neighbors c of a and b, where b is an arc of a, end the end of
+    // the arcs of a, and the higher neighbors of a are marked
+    template <bool WEIGHTED>
+    __attribute__((always_inline)) std::uint64_t common(int a, const CSRGraph::Arc* b,
+                                                         const CSRGraph::Arc* end,
+                                                         const char* mark,
+                                                         const std::uint32_t* w) const {
+        std::uint64_t s = 0;
+        if (b->to < heavy) {
+            for (auto c : g.higher(b->to)) {
+                if (mark[c.to]) s += WEIGHTED ? w[c.to] : 1;
+            }
+        } else if (a < heavy) {
+            for (auto c = b + 1; c != end; c++) {
+                if (test(b->to, c->to)) s += WEIGHTED ? w[c->to] : 1;
+            }
+        } else {
+            const std::uint64_t *ra = row(a), *rb = row(b->to);
+            for (int i = 0; i < words; i++) {
+                std::uint64_t bits = ra[i] & rb[i];
+                if (!WEIGHTED) {
+                    s += __builtin_popcountll(bits);
+                    continue;
+                }
+                while (bits) {
+                    s += w[heavy + 64 * i + __builtin_ctzll(bits)];
+                    bits &= bits - 1;
+                }
+            }
+        }
+        return s;
+    }
+
+    __attribute__((always_inline)) std::uint64_t count_impl(int from, int to) const {
+        std::vector<char> mark(g.size(), false);
+        std::uint64_t res = 0;
+        for (int a = from; a < to; a++) {
+            auto up = g.higher(a);
+            for (auto c : up) mark[c.to] = true;
+            for (auto b = up.begin(); b != up.end(); b++) {
+                res += common<false>(a, b, up.end(), mark.data(), nullptr);
+            }
+            for (auto c : up) mark[c.to] = false;
+        }
+        return res;
+    }
+
+#if defined(LIBRARY_CHECKER_X86)
+    __attribute__((target("popcnt"))) std::uint64_t count_popcnt(int from, int to) const {
+        return count_impl(from, to);
+    }
+#endif
+};
+
+// For each edge of a multigraph without loops, the number of 4-cycles
+// through it, as sets of 4 edges.
+//
+// The parallel edges are merged into one edge of weight the multiplicity.
+// A 4-cycle is counted from its highest rank v: c[x] is the weighted
+// number of paths v - w - x with w, x < v, and every path v - w - x then
+// closes c[x] - W(vw) W(wx) cycles through its two edges. The arcs are
+// sorted by rank, so the neighbors of w below v are a prefix of its arcs
+// and v does not depend on the other tops. The arcs are packed once with
+// their weights into {to, id, weight} records of 16 bytes.
+//
+// The tops v are split among `threads` workers, each with its own c and
+// its own answers, which are added up at the end.
+inline std::vector<long long> c4_counts(int n, const std::vector<std::pair<int, int>>& edges,
+                                        int threads = 1) {
+    int m = int(edges.size());
+    // merge parallel edges: simple[q[e]] is the merged edge of edge e
+    std::vector<std::uint64_t> keys(m);
+    for (int e = 0; e < m; e++) {
+        auto [u, v] = edges[e];
+        if (u > v) std::swap(u, v);
+        keys[e] = std::uint64_t(u) << 32 | std::uint64_t(v);
+    }
+    std::vector<int> order(m);
+    for (int e = 0; e < m; e++) order[e] = e;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return keys[a] < keys[b]; });
+    std::vector<int> q(m);
+    std::vector<std::pair<int, int>> simple;
+    std::vector<long long> mult;
+    for (int i = 0; i < m; i++) {
+        int e = order[i];
+        if (i == 0 || keys[e] != keys[order[i - 1]]) {
+            simple.emplace_back(int(keys[e] >> 32), int(keys[e] & 0xffffffff));
+            mult.push_back(0);
+        }
+        mult.back()++;
+        q[e] = int(simple.size()) - 1;
+    }
+
+    DegreeOrderedGraph g(n, simple);
+    int k = int(simple.size());
+    // the arcs packed with their weights, by rank
+    struct Arc {
+        int to, id;
+        long long w;
+    };
+    std::vector<int> start(n + 1, 0);
+    std::vector<Arc> arcs;
+    arcs.reserve(2 * k);
+    for (int r = 0; r < n; r++) {
+        for (auto a : g[r]) arcs.push_back({a.to, a.id, mult[g.edge[a.id]]});
+        start[r + 1] = int(arcs.size());
+    }
+
+    threads = std::max(threads, 1);
+    std::vector<std::vector<long long>> ans(threads);
+    internal::parallel_ranks(n, threads, [&](int from, int to, int worker) {
+        auto& res = ans[worker];
+        if (res.empty()) res.assign(k, 0);
+        std::vector<long long> c(n, 0);
+        // the end of the arcs of w below v, for each arc v -> w
+        std::vector<const Arc*> below;
+        for (int v = from; v < to; v++) {
+            const Arc *first = arcs.data() + start[v], *last = first + g.lower(v).size();
+            below.clear();
+            long long paths = 0;
+            for (const Arc* vw = first; vw != last; vw++) {
+                const Arc *b = arcs.data() + start[vw->to], *e = arcs.data() + start[vw->to + 1];
+                e = std::lower_bound(b, e, v, [](const Arc& a, int r) { return a.to < r; });
+                below.push_back(e);
+                paths += e - b;
+                for (const Arc* wx = b; wx != e; wx++) c[wx->to] += vw->w * wx->w;
+            }
+            for (const Arc* vw = first; vw != last; vw++) {
+                long long sum = 0;
+                const Arc* b = arcs.data() + start[vw->to];
+                for (const Arc* wx = b; wx != below[vw - first]; wx++) {
+                    long long val = c[wx->to] - vw->w * wx->w;
+                    sum += val * wx->w;
+                    res[wx->id] += val * vw->w;
+                }
+                res[vw->id] += sum;
+            }
+            // all of c below v at once when that is fewer writes
+            if (paths >= v) {
+                std::fill(c.begin(), c.begin() + v, 0);
+                continue;
+            }
+            for (const Arc* vw = first; vw != last; vw++) {
+                const Arc* b = arcs.data() + start[vw->to];
+                for (const Arc* wx = b; wx != below[vw - first]; wx++) c[wx->to] = 0;
+            }
+        }
+    });
+
+    std::vector<long long> merged(k, 0);
+    for (auto& res : ans) {
+        for (int i = 0; i < int(res.size()); i++) merged[g.edge[i]] += res[i];
+    }
+    std::vector<long long> res(m);
+    for (int e = 0; e < m; e++) res[e] = merged[q[e]];
+    return res;
+}
+
+}  // namespace library_checker
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "rmq.h"
+
+namespace library_checker {
+
+// Static queries on a rooted tree: LCA in O(1) and level ancestor in O(1).
+//
+// Vertices are relabeled in preorder, visiting the child of the largest
+// height first, and every table is indexed by the label. A long path (a
+// vertex, its highest child, that child's highest child, ...) is then a
+// contiguous range of labels, and the tables a query touches are close to
+// each other.
+//
+// - lca: for labels u < v, the LCA is the smallest parent label among the
+//   labels (u, v], since that range stays in the subtree of the LCA and
+//   contains the child of it towards v. This is the Euler tour RMQ with
+//   the tour read in preorder, n entries instead of 2n - 1, and the RMQ
+//   returns the label of the LCA itself.
+// - level_ancestor: ladder decomposition. Each long path of L vertices is
+//   stored with the L ancestors above its top (the ladder), and every leaf
+//   keeps the jump pointers to its 2^i-th ancestors in one row. A query
+//   within the ladder of v is one load. Otherwise it goes to the leaf at
+//   the bottom of the long path of v, takes the largest jump that stays on
+//   the path to the target, and finishes on the ladder of the vertex it
+//   lands on, which is high enough by construction.
+//
+// What a query reads of a vertex is one aligned 32-byte Node. Everything
+// is built without recursion, O(n log n) words for the jump rows of the
+// leaves and O(n) for the rest.
+struct TreeQuery {
+    TreeQuery() = default;
+    TreeQuery(int n_, const std::vector<std::pair<int, int>>& edges, int root = 0) : n(n_) {
+        assert(int(edges.size()) == n - 1 && 0 <= root && root < n);
+        CSRGraph g = CSRGraph::undirected(n, edges);
+
+        // BFS for parents, heights in reverse BFS order
+        std::vector<int> order = {root}, orig_par(n, -1), height(n, 0), high(n, -1);
+        order.reserve(n);
+        for (int i = 0; i < int(order.size()); i++) {
+            int v = order[i];
+            for (auto a : g[v]) {
+                if (a.to == orig_par[v]) continue;
+                orig_par[a.to] = v;
+                order.push_back(a.to);
+            }
+        }
+        assert(int(order.size()) == n);
+        for (int i = n - 1; i >= 1; i--) {
+            int v = order[i], p = orig_par[v];
+            if (high[p] == -1 || height[p] < height[v] + 1) {
+                height[p] = height[v] + 1;
+                high[p] = v;
+            }
+        }
+
+        // preorder, the highest child first
+        label.resize(n);
+        std::vector<int> vertex(n);
+        {
+            std::vector<int> st = {root};
+            int t = 0;
+            while (!st.empty()) {
+                int v = st.back();
+                st.pop_back();
+                label[v] = t;
+                vertex[t++] = v;
+                for (auto a : g[v]) {
+                    if (a.to != orig_par[v] && a.to != high[v]) st.push_back(a.to);
+                }
+                if (high[v] != -1) st.push_back(high[v]);
+            }
+        }
+        node.resize(n);
+        for (int l = 0; l < n; l++) {
+            Node& x = node[l];
+            x.vertex = vertex[l];
+            x.par = orig_par[x.vertex] == -1 ? -1 : label[orig_par[x.vertex]];
+            x.dep = l == 0 ? 0 : node[x.par].dep + 1;
+            x.h = height[x.vertex];
+        }
+
+        build_lca();
+        build_ladders();
+    }
+
+    int size() const { return n; }
+    int depth(int v) const { return node[label[v]].dep; }
+    // -1 for the root
+    int parent(int v) const {
+        int p = node[label[v]].par;
+        return p == -1 ? -1 : node[p].vertex;
+    }
+
+    int lca(int u, int v) const { return node[lca_label(label[u], label[v])].vertex; }
+
+    // lca(u, v) of each query, in the order of the queries.
+    //
+    // The label ranges are computed first, prefetching the labels of the
+    // query PREFETCH ahead, and are then answered by RMQ::argmin_batch.
+    std::vector<int> lca_batch(const std::vector<std::pair<int, int>>& queries) const {
+        std::size_t q = queries.size();
+        std::vector<std::pair<int, int>> ranges(q);
+        for (std::size_t i = 0; i < q; i++) {
+            if (i + PREFETCH < q) {
+                __builtin_prefetch(label.data() + queries[i + PREFETCH].first);
+                __builtin_prefetch(label.data() + queries[i + PREFETCH].second);
+            }
+            int lu = label[queries[i].first], lv = label[queries[i].second];
+            if (lu > lv) std::swap(lu, lv);
+            // u == v gets any valid range, it is not used
+            ranges[i] = {lu == lv ? lu : lu + 1, lv + 1};
+        }
+        std::vector<int> res = parents.argmin_batch(ranges);
+        for (std::size_t i = 0; i < q; i++) {
+            auto [u, v] = queries[i];
+            res[i] = u == v ? u : node[node[res[i]].par].vertex;
+        }
+        return res;
+    }
+
+    // the ancestor of v k edges above, -1 if k > depth(v)
+    int level_ancestor(int v, int k) const {
+        int l = ancestor_label(label[v], k);
+        return l == -1 ? -1 : node[l].vertex;
+    }
+
+    int dist(int u, int v) const {
+        int lu = label[u], lv = label[v];
+        return node[lu].dep + node[lv].dep - 2 * node[lca_label(lu, lv)].dep;
+    }
+
+    // the vertex k edges from u on the path to v, -1 if k > dist(u, v)
+    int jump(int u, int v, int k) const {
+        int lu = label[u], lv = label[v], c = lca_label(lu, lv);
+        int du = node[lu].dep - node[c].dep, dv = node[lv].dep - node[c].dep;
+        if (k < 0 || k > du + dv) return -1;
+        int l = k <= du ? ancestor_label(lu, k) : ancestor_label(lv, du + dv - k);
+        return node[l].vertex;
+    }
+
+  private:
+    static constexpr std::size_t PREFETCH = 16;
+
+    // what a query reads of a vertex, in one 32-byte record
+    struct alignas(32) Node {
+        int vertex;
+        int par;  // -1 for the root
+        int dep, h;
+        int ladder_pos;  // position in ladders, the ancestors are to its left
+        int reach;       // number of ancestors left of ladder_pos
+        int jump_row;    // row of the jump pointers of the bottom of its long path
+    };
+
+    int n = 0, lg = 0;
+    // vertex -> preorder label
+    std::vector<int> label;
+    // by label
+    std::vector<Node> node;
+
+    // RMQ of the parent labels by label
+    RMQ<int> parents;
+
+    std::vector<int> ladders;
+    // 2^i-th ancestor of the leaf of row r at jumps[r * lg + i]
+    std::vector<int> jumps;
+
+    void build_lca() {
+        std::vector<int> par(n);
+        for (int l = 0; l < n; l++) par[l] = node[l].par;
+        parents = RMQ<int>(std::move(par));
+    }
+
+    int lca_label(int lu, int lv) const {
+        if (lu == lv) return lu;
+        if (lu > lv) std::swap(lu, lv);
+        return parents.min(lu + 1, lv + 1);
+    }
+
+    void build_ladders() {
+        int max_dep = 0;
+        for (const Node& x : node) max_dep = std::max(max_dep, x.dep);
+        lg = 1;
+        while ((1 << lg) <= max_dep) lg++;
+
+        // the long path of top t is the labels [t, t + h[t]]
+        ladders.reserve(2 * n);
+        std::vector<int> up;
+        int rows = 0;
+        for (int t = 0; t < n; t++) {
+            if (t != 0 && node[t].par == t - 1) continue;  // not a top
+            int len = node[t].h + 1;
+            up.clear();
+            for (int x = node[t].par; x != -1 && int(up.size()) < len; x = node[x].par) {
+                up.push_back(x);
+            }
+            ladders.insert(ladders.end(), up.rbegin(), up.rend());
+            for (int l = t; l < t + len; l++) {
+                node[l].ladder_pos = int(ladders.size());
+                node[l].reach = int(up.size()) + (l - t);
+                node[l].jump_row = rows;
+                ladders.push_back(l);
+            }
+            rows++;
+        }
+
+        jumps.assign(std::size_t(rows) * lg, -1);
+        for (int l = 0; l < n; l++) {
+            if (node[l].h != 0) continue;
+            int* row = jumps.data() + std::size_t(node[l].jump_row) * lg;
+            if (node[l].dep >= 1) row[0] = node[l].par;
+            // the 2^(i-1)-th ancestor has height >= 2^(i-1), so its ladder
+            // reaches 2^(i-1) further up
+            for (int i = 1; i < lg && (1 << i) <= node[l].dep; i++) {
+                row[i] = ladders[node[row[i - 1]].ladder_pos - (1 << (i - 1))];
+            }
+        }
+    }
+
+    int ancestor_label(int l, int k) const {
+        const Node& x = node[l];
+        if (k < 0 || k > x.dep) return -1;
+        if (k <= x.reach) return ladders[x.ladder_pos - k];
+        // from the leaf at the bottom of the long path of l
+        k += x.h;
+        int i = 31 - __builtin_clz(unsigned(k));
+        int u = jumps[std::size_t(x.jump_row) * lg + i];
+        return ladders[node[u].ladder_pos - (k - (1 << i))];
+    }
+};
+
+}  // namespace library_checker
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace library_checker {
+
+// Disjoint set union by size with path halving.
+//
+// One int per element: the parent, or minus the size of the set for a
+// root. leader() walks to the root in a loop and links every visited node
+// to its grandparent, so there is no recursion and no stack to overflow
+// on a long chain; with union by size it is O(α(n)) amortized.
+struct UnionFind {
+    UnionFind() = default;
+    explicit UnionFind(int n_) : n(n_), groups(n_), p(n_, -1) {}
+
+    int leader(int a) {
+        assert(0 <= a && a < n);
+        while (p[a] >= 0) {
+            int b = p[a];
+            if (p[b] < 0) return b;
+            a = p[a] = p[b];
+        }
+        return a;
+    }
+
+    // false if a and b are already in the same set
+    bool merge(int a, int b) {
+        int x = leader(a), y = leader(b);
+        if (x == y) return false;
+        if (p[x] > p[y]) std::swap(x, y);
+        p[x] += p[y];
+        p[y] = x;
+        groups--;
+        return true;
+    }
+
+    bool same(int a, int b) { return leader(a) == leader(b); }
+    int size(int a) { return -p[leader(a)]; }
+    int count() const { return groups; }
+
+    // merge(a, b) for each query in order
+    void merge_all(const std::vector<std::pair<int, int>>& queries) {
+        std::size_t q = queries.size();
+        for (std::size_t i = 0; i < q; i++) {
+            if (i + PREFETCH < q) prefetch(queries[i + PREFETCH]);
+            merge(queries[i].first, queries[i].second);
+        }
+    }
+
+    // same(a, b) for each query in order
+    std::vector<char> same_all(const std::vector<std::pair<int, int>>& queries) {
+        std::size_t q = queries.size();
+        std::vector<char> res(q);
+        for (std::size_t i = 0; i < q; i++) {
+            if (i + PREFETCH < q) prefetch(queries[i + PREFETCH]);
+            res[i] = same(queries[i].first, queries[i].second);
+        }
+        return res;
+    }
+
+  private:
+    // the *_all functions load the first node of the query this far ahead,
+    // which overlaps the cache misses of independent queries
+    static constexpr std::size_t PREFETCH = 8;
+
+    int n = 0, groups = 0;
+    // parent, or -size for a root
+    std::vector<int> p;
+
+    void prefetch(const std::pair<int, int>& query) const {
+        __builtin_prefetch(p.data() + query.first);
+        __builtin_prefetch(p.data() + query.second);
+    }
+};
+
+// Union-find that keeps the potential of every element relative to the
+// root of its set, over a group (G, op, id, inv) that need not be
+// commutative.
+//
+// pot(v) is defined by pot(v) = op(pot(parent), w(v)) where w(v) is the
+// weight of the edge to the parent; a root has potential id(). leader()
+// halves paths in a loop like UnionFind and folds the weights of the
+// skipped edges, so it needs no recursion either.
+template <class G, G (*id)(), G (*op)(const G&, const G&), G (*inv)(const G&)>
+struct PotentialUnionFind {
+    PotentialUnionFind() = default;
+    explicit PotentialUnionFind(int n_) : n(n_), p(n_, -1), w(n_, id()) {}
+
+    int leader(int a) {
+        assert(0 <= a && a < n);
+        while (p[a] >= 0) {
+            int b = p[a];
+            if (p[b] < 0) return b;
+            w[a] = op(w[b], w[a]);
+            a = p[a] = p[b];
+        }
+        return a;
+    }
+
+    // potential of a relative to its root
+    G potential(int a) {
+        leader(a);
+        G x = w[a];
+        for (int b = p[a]; b >= 0 && p[b] >= 0; b = p[b]) x = op(w[b], x);
+        return x;
+    }
+
+    // op(pot(a), d) = pot(b); false if it contradicts the known potentials
+    bool merge(int a, int b, G d) {
+        G pa = potential(a), pb = potential(b);
+        int x = leader(a), y = leader(b);
+        if (x == y) return op(inv(pa), pb) == d;
+        // pot(y) relative to x
+        G wy = op(op(pa, d), inv(pb));
+        if (p[x] > p[y]) {
+            std::swap(x, y);
+            wy = inv(wy);
+        }
+        p[x] += p[y];
+        p[y] = x;
+        w[y] = wy;
+        return true;
+    }
+
+    bool same(int a, int b) { return leader(a) == leader(b); }
+    int size(int a) { return -p[leader(a)]; }
+
+    // op(inv(pot(a)), pot(b)), a and b must be in the same set
+    G diff(int a, int b) {
+        assert(same(a, b));
+        return op(inv(potential(a)), potential(b));
+    }
+
+  private:
+    int n = 0;
+    // parent, or -size for a root
+    std::vector<int> p;
+    // weight of the edge to the parent
+    std::vector<G> w;
+};
+
+}  // namespace library_checker
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_features.h"
+
+namespace library_checker {
+
+// Succinct bit vector with rank and select.
+//
+// Bits are stored in blocks of 512 bits (8 words). Each block is one
+// interleaved record of the number of ones before it and the 9-bit counts of
+// ones before each of its words (rank9), so rank reads one record and pays
+// 25% of space overhead. select searches the blocks by binary search
+// narrowed by samples of every 2^SELECT_SHIFT-th one (or zero).
+//
+// Use set() on a vector of size n and then build() once.
+struct BitVector {
+    static constexpr int SELECT_SHIFT = 12;
+
+    BitVector() = default;
+    explicit BitVector(std::size_t n_) : n(n_), blocks(n_ / 512 + 1) {}
+
+    std::size_t size() const { return n; }
+    std::size_t count1() const { return ones; }
+    std::size_t count0() const { return n - ones; }
+
+    void set(std::size_t i) {
+        assert(i < n);
+        blocks[i >> 9].w[(i >> 6) & 7] |= std::uint64_t(1) << (i & 63);
+    }
+    bool operator[](std::size_t i) const {
+        assert(i < n);
+        return (blocks[i >> 9].w[(i >> 6) & 7] >> (i & 63)) & 1;
+    }
+
+    void build() {
+        std::uint64_t sum = 0;
+        for (Block& b : blocks) {
+            b.abs = sum;
+            b.rel = 0;
+            std::uint64_t in = 0;
+            for (int j = 0; j < 8; j++) {
+                if (j) b.rel |= in << (9 * (j - 1));
+                in += __builtin_popcountll(b.w[j]);
+            }
+            sum += in;
+        }
+        ones = std::size_t(sum);
+        hint1.clear();
+        hint0.clear();
+        for (std::size_t i = 0; i < blocks.size(); i++) {
+            std::size_t one = blocks[i].abs, zero = 512 * i - one;
+            // hint[k]: block containing the (k << SELECT_SHIFT)-th one
+            while ((hint1.size() << SELECT_SHIFT) < one) hint1.push_back(std::uint32_t(i - 1));
+            while ((hint0.size() << SELECT_SHIFT) < zero) hint0.push_back(std::uint32_t(i - 1));
+        }
+        while ((hint1.size() << SELECT_SHIFT) <= ones) hint1.push_back(std::uint32_t(blocks.size() - 1));
+        while ((hint0.size() << SELECT_SHIFT) <= n - ones) hint0.push_back(std::uint32_t(blocks.size() - 1));
+        // upper bound of the search for the last samples
+        hint1.push_back(std::uint32_t(blocks.size() - 1));
+        hint0.push_back(std::uint32_t(blocks.size() - 1));
+    }
+
+    // number of ones in [0, i)
+    __attribute__((always_inline)) std::size_t rank1(std::size_t i) const {
+        assert(i <= n);
+        const Block& b = blocks[i >> 9];
+        std::size_t j = (i >> 6) & 7;
+        std::uint64_t in = j ? (b.rel >> (9 * (j - 1))) & 511 : 0;
+        std::uint64_t mask = (std::uint64_t(1) << (i & 63)) - 1;
+        return std::size_t(b.abs + in + __builtin_popcountll(b.w[j] & mask));
+    }
+    // number of zeros in [0, i)
+    __attribute__((always_inline)) std::size_t rank0(std::size_t i) const {
+        return i - rank1(i);
+    }
+
+    // position of the k-th one (0-indexed), k < count1()
+    std::size_t select1(std::size_t k) const {
+        assert(k < ones);
+        return select<true>(k);
+    }
+    // position of the k-th zero (0-indexed), k < count0()
+    std::size_t select0(std::size_t k) const {
+        assert(k < n - ones);
+        return select<false>(k);
+    }
+
+  private:
+    struct Block {
+        std::uint64_t abs = 0;  // ones before this block
+        std::uint64_t rel = 0;  // 9-bit ones before word j at 9 (j - 1)
+        std::uint64_t w[8] = {};
+    };
+
+    std::size_t n = 0, ones = 0;
+    std::vector<Block> blocks;
+    std::vector<std::uint32_t> hint1, hint0;
+
+    template <bool ONE> std::size_t select(std::size_t k) const {
+        auto before = [&](std::size_t i) -> std::size_t {
+            return ONE ? blocks[i].abs : 512 * i - blocks[i].abs;
+        };
+        const auto& hint = ONE ? hint1 : hint0;
+        // last block with before(block) <= k
+        std::size_t lo = hint[k >> SELECT_SHIFT], hi = hint[(k >> SELECT_SHIFT) + 1] + 1;
+        while (hi - lo > 1) {
+            std::size_t mid = (lo + hi) / 2;
+            (before(mid) <= k ? lo : hi) = mid;
+        }
+        const Block& b = blocks[lo];
+        k -= before(lo);
+        int j = 0;
+        while (j < 7) {
+            std::size_t in = (b.rel >> (9 * j)) & 511;
+            if (!ONE) in = 64 * (j + 1) - in;
+            if (in > k) break;
+            j++;
+        }
+        if (j) {
+            std::size_t in = (b.rel >> (9 * (j - 1))) & 511;
+            k -= ONE ? in : 64 * j - in;
+        }
+        std::uint64_t x = ONE ? b.w[j] : ~b.w[j];
+        for (; k; k--) x &= x - 1;
+        return 512 * lo + 64 * j + __builtin_ctzll(x);
+    }
+};
+
+// Wavelet matrix of non-negative integers less than 2^bit_length.
+//
+// Level p (from bit_length - 1 down to 0) is a BitVector of the p-th bits of
+// the values, stably sorted by their higher bits in reversed order. Every
+// query walks the levels once, with two rank calls per level, so it is
+// O(bit_length).
+//
+// On x86 CPUs with POPCNT, the queries run in a copy compiled for it.
+template <class T> struct WaveletMatrix {
+    WaveletMatrix() = default;
+    // the directories of the levels are built by `threads` workers
+    WaveletMatrix(std::vector<T> a, int bit_length, int threads = 1)
+        : n(a.size()), mat(bit_length), zeros(bit_length) {
+        assert(0 <= bit_length && bit_length <= std::numeric_limits<T>::digits);
+        std::vector<T> tmp(n);
+        for (int p = bit_length - 1; p >= 0; p--) {
+            BitVector& v = mat[p];
+            v = BitVector(n);
+            std::size_t z = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                assert(below(a[i], bit_length));
+                if ((a[i] >> p) & 1) v.set(i);
+                else z++;
+            }
+            zeros[p] = z;
+            std::size_t i0 = 0, i1 = z;
+            for (std::size_t i = 0; i < n; i++) {
+                ((a[i] >> p) & 1 ? tmp[i1++] : tmp[i0++]) = a[i];
+            }
+            std::swap(a, tmp);
+        }
+        threads = std::max(1, std::min(threads, bit_length));
+        auto run = [&](int from, int to) {
+            for (int p = from; p < to; p++) mat[p].build();
+        };
+        if (threads == 1) {
+            run(0, bit_length);
+            return;
+        }
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back(run, bit_length * i / threads,
+                                 bit_length * (i + 1) / threads);
+        }
+        for (auto& th : workers) th.join();
+    }
+
+    std::size_t size() const { return n; }
+
+    // k-th smallest (0-indexed) of [l, r), k < r - l
+    T kth_smallest(std::size_t l, std::size_t r, std::size_t k) const {
+        assert(l <= r && r <= n && k < r - l);
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::popcnt)) return kth_smallest_popcnt(l, r, k);
+#endif
+        return kth_smallest_impl(l, r, k);
+    }
+    T kth_largest(std::size_t l, std::size_t r, std::size_t k) const {
+        assert(l <= r && r <= n && k < r - l);
+        return kth_smallest(l, r, r - l - 1 - k);
+    }
+
+    // number of x in [0, r)
+    std::size_t rank(T x, std::size_t r) const {
+        assert(r <= n);
+        if (!below(x, levels())) return 0;
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::popcnt)) return rank_popcnt(x, r);
+#endif
+        return rank_impl(x, r);
+    }
+
+    // number of values in [lower, upper) of [l, r)
+    std::size_t range_freq(std::size_t l, std::size_t r, T lower, T upper) const {
+        assert(l <= r && r <= n);
+        if (lower >= upper) return 0;
+        return count_less(l, r, upper) - count_less(l, r, lower);
+    }
+
+    // largest value less than upper in [l, r)
+    std::optional<T> prev_value(std::size_t l, std::size_t r, T upper) const {
+        std::size_t c = count_less(l, r, upper);
+        if (c == 0) return std::nullopt;
+        return kth_smallest(l, r, c - 1);
+    }
+    // smallest value not less than lower in [l, r)
+    std::optional<T> next_value(std::size_t l, std::size_t r, T lower) const {
+        std::size_t c = count_less(l, r, lower);
+        if (c == r - l) return std::nullopt;
+        return kth_smallest(l, r, c);
+    }
+
+  private:
+    std::size_t n = 0;
+    std::vector<BitVector> mat;
+    // number of zeros of each level
+    std::vector<std::size_t> zeros;
+
+    int levels() const { return int(mat.size()); }
+
+    static bool negative(T x) {
+        if constexpr (std::is_signed<T>::value) return x < 0;
+        return false;
+    }
+    // 0 <= x < 2^bits
+    static bool below(T x, int bits) {
+        if (negative(x)) return false;
+        return bits >= std::numeric_limits<T>::digits || (x >> bits) == 0;
+    }
+
+    // number of values less than upper in [l, r)
+    std::size_t count_less(std::size_t l, std::size_t r, T upper) const {
+        assert(l <= r && r <= n);
+        if (upper == 0 || negative(upper)) return 0;
+        if (!below(upper, levels())) return r - l;
+#if defined(LIBRARY_CHECKER_X86)
+        if (cpu_supports(CpuFeature::popcnt)) return count_less_popcnt(l, r, upper);
+#endif
+        return count_less_impl(l, r, upper);
+    }
+
+    __attribute__((always_inline)) T kth_smallest_impl(std::size_t l, std::size_t r,
+                                                       std::size_t k) const {
+        T res = 0;
+        for (int p = levels() - 1; p >= 0; p--) {
+            const BitVector& v = mat[p];
+            std::size_t l0 = v.rank0(l), r0 = v.rank0(r);
+            if (k < r0 - l0) {
+                l = l0, r = r0;
+            } else {
+                k -= r0 - l0;
+                res |= T(1) << p;
+                l = zeros[p] + (l - l0), r = zeros[p] + (r - r0);
+            }
+        }
+        return res;
+    }
+
+    __attribute__((always_inline)) std::size_t rank_impl(T x, std::size_t r) const {
+        std::size_t l = 0;
+        for (int p = levels() - 1; p >= 0; p--) {
+            const BitVector& v = mat[p];
+            if ((x >> p) & 1) {
+                l = zeros[p] + v.rank1(l), r = zeros[p] + v.rank1(r);
+            } else {
+                l = v.rank0(l), r = v.rank0(r);
+            }
+        }
+        return r - l;
+    }
+
+    __attribute__((always_inline)) std::size_t count_less_impl(std::size_t l, std::size_t r,
+                                                               T upper) const {
+        std::size_t res = 0;
+        for (int p = levels() - 1; p >= 0; p--) {
+            const BitVector& v = mat[p];
+            std::size_t l0 = v.rank0(l), r0 = v.rank0(r);
+            if ((upper >> p) & 1) {
+                res += r0 - l0;
+                l = zeros[p] + (l - l0), r = zeros[p] + (r - r0);
+            } else {
+                l = l0, r = r0;
+            }
+        }
+        return res;
+    }
+
+#if defined(LIBRARY_CHECKER_X86)
+    __attribute__((target("popcnt"))) T kth_smallest_popcnt(std::size_t l, std::size_t r,
+                                                            std::size_t k) const {
+        return kth_smallest_impl(l, r, k);
+    }
+    __attribute__((target("popcnt"))) std::size_t rank_popcnt(T x, std::size_t r) const {
+        return rank_impl(x, r);
+    }
+    __attribute__((target("popcnt"))) std::size_t count_less_popcnt(std::size_t l, std::size_t r,
+                                                                    T upper) const {
+        return count_less_impl(l, r, upper);
+    }
+#endif
+};
+
+}  // namespace library_checker
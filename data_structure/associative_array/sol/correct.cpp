@@ -1,10 +1,11 @@
 #include <cstdio>
-#include <map>
+
+#include "hash_map.h"
 
 int main() {
     int q;
     scanf("%d", &q);
-    std::map<long long, long long> mp;
+    library_checker::HashMap<long long, long long> mp(q);
     for (int i = 0; i < q; i++) {
         int type;
         scanf("%d", &type);
@@ -15,7 +16,8 @@ int main() {
         } else {
             long long key;
             scanf("%lld", &key);
-            printf("%lld\n", mp[key]);
+            const long long *val = mp.find(key);
+            printf("%lld\n", val ? *val : 0LL);
         }
     }
     return 0;
@@ -3,6 +3,8 @@
 #include <cassert>
 #include <cstdint>
 
+#include "arena.h"
+
 int ri() {
 	int n;
 	scanf("%d", &n);
@@ -68,8 +70,9 @@ struct AVL {
 			} else return fetch();
 		}
 	};
-	static int head;
-	static Node *nodes, *NONE, *removed_tmp;
+	static library_checker::Pool<Node> nodes;
+	static Node none;
+	static Node *NONE, *removed_tmp;
 	Node *root = NONE;
 	
 	AVL () = default;
@@ -83,11 +86,11 @@ struct AVL {
 		int *mid = start + ((end - start) >> 1);
 		Node *l = construct(start, mid);
 		Node *r = construct(mid + 1, end);
-		return (nodes[head++] = {l, r, 0, *mid, {1, 0}, 0, 0, false}).fetch();
+		return nodes.make_ptr(Node{l, r, 0, *mid, {1, 0}, 0, 0, false})->fetch();
 	}
 	
 	static Node *insert(Node *node, int i, int x) {
-		if (node == NONE) return &(nodes[head++] = {NONE, NONE, x, x, {1, 0}, 1, 1, false});
+		if (node == NONE) return nodes.make_ptr(Node{NONE, NONE, x, x, {1, 0}, 1, 1, false});
 		node->flush();
 		int lsize = node->l->size;
 		if (i <= lsize) node->l = insert(node->l, i, x);
@@ -175,7 +178,7 @@ struct AVL {
 			puts("NONE");
 			return;
 		}
-		printf("#%d : %d, sum:%d, sh:{%d, %d}\n", (int) (node - nodes), node->self, node->sum, node->size, node->height);
+		printf("#%p : %d, sum:%d, sh:{%d, %d}\n", (void *) node, node->self, node->sum, node->size, node->height);
 		debug(node->l, indent + 1);
 		debug(node->r, indent + 1);
 	}
@@ -202,8 +205,10 @@ struct AVL {
 	}
 	void debug() { debug(root, 0); }
 };
-int AVL::head = 1;
-AVL::Node *AVL::nodes = new Node[1000001], *AVL::NONE = nodes, *AVL::removed_tmp;
+library_checker::Pool<AVL::Node> AVL::nodes;
+// empty subtree, its lazy may be written by flush() but is never read
+AVL::Node AVL::none{&AVL::none, &AVL::none, 0, 0, {1, 0}, 0, 0, false};
+AVL::Node *AVL::NONE = &AVL::none, *AVL::removed_tmp;
 
 
 int main() {
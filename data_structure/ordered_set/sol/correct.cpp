@@ -4,6 +4,8 @@
 #include <tuple>
 #include <cstdlib>
 
+#include "arena.h"
+
 using namespace std;
 
 using ll = long long;
@@ -57,23 +59,16 @@ struct Dynamic_SegTree_Sparse {
     Node *l, *r;
     X prod, x;
   };
-  const int NODES;
   const ll L0, R0;
-  Node *pool;
-  int pid;
+  library_checker::Pool<Node> pool;
   using np = Node *;
 
-  Dynamic_SegTree_Sparse(int NODES, ll L0, ll R0) : NODES(NODES), L0(L0), R0(R0), pid(0) { pool = new Node[NODES]; }
-  ~Dynamic_SegTree_Sparse() { delete[] pool; }
+  Dynamic_SegTree_Sparse(ll L0, ll R0) : L0(L0), R0(R0), pool(true) {}
 
   np new_root() { return nullptr; }
 
   np new_node(ll idx, const X x) {
-    assert(pid < NODES);
-    pool[pid].idx = idx;
-    pool[pid].l = pool[pid].r = nullptr;
-    pool[pid].x = pool[pid].prod = x;
-    return &(pool[pid++]);
+    return pool.make_ptr(Node{idx, nullptr, nullptr, x, x});
   }
 
   X prod(np root, ll l, ll r) {
@@ -112,13 +107,7 @@ private:
 
   np copy_node(np c) {
     if (!c || !PERSISTENT) return c;
-    assert(pid < NODES);
-    pool[pid].idx = c->idx;
-    pool[pid].l = c->l;
-    pool[pid].r = c->r;
-    pool[pid].x = c->x;
-    pool[pid].prod = c->prod;
-    return &(pool[pid++]);
+    return pool.make_ptr(*c);
   }
 
   np set_rec(np c, ll l, ll r, ll i, X x) {
@@ -213,7 +202,7 @@ void solve() {
 
   const int INF = 1'000'000'100;
 
-  Dynamic_SegTree_Sparse<Monoid_Add<int>, 0> seg(N + Q, 0, INF);
+  Dynamic_SegTree_Sparse<Monoid_Add<int>, 0> seg(0, INF);
   using np = decltype(seg)::np;
   np root = seg.new_root();
 
@@ -1,90 +1,91 @@
 #include <cassert>
-#include <memory>
-#include <type_traits>
+#include <cstdint>
 #include <utility>
 
+#include "arena.h"
+
 template <class T> class persistent_queue {
   using Self = persistent_queue<T>;
-  class node_type;
-  using node_ptr = std::shared_ptr<node_type>;
-  using raw_ptr = node_type *;
-  class stream_type;
-  using stream_ptr = std::shared_ptr<stream_type>;
-
-  template <class... Args> static node_ptr make_node(Args &&... args) {
-    return std::make_shared<node_type>(std::forward<Args>(args)...);
+  using index = std::uint32_t;
+
+  // nodes and streams are shared by versions and never freed
+  struct node_type {
+    T value;
+    index next;
+  };
+
+  struct stream_type {
+    index scan;
+    index rotate;
+  };
+
+  static library_checker::Pool<node_type> &nodes() {
+    static library_checker::Pool<node_type> pool;
+    return pool;
   }
 
-  template <class... Args> static stream_ptr make_stream(Args &&... args) {
-    return std::make_shared<stream_type>(std::forward<Args>(args)...);
+  static library_checker::Pool<stream_type> &streams() {
+    static library_checker::Pool<stream_type> pool;
+    return pool;
   }
 
-  class node_type {
-  public:
-    T value;
-    node_ptr next;
+  static constexpr index null = library_checker::Pool<node_type>::null;
 
-    template <class Nptr>
-    node_type(T value, Nptr &&n)
-        : value(std::move(value)), next(std::forward<Nptr>(n)) {}
-  };
+  static index make_node(T value, index next) {
+    return nodes().make(std::move(value), next);
+  }
 
-  class stream_type {
-  public:
-    node_ptr scan;
-    node_ptr rotate;
-
-    template <class Rptr>
-    stream_type(const node_ptr &s, Rptr &&r)
-        : scan(s), rotate(std::forward<Rptr>(r)) {}
-
-    node_ptr next() {
-      node_ptr ret;
-      if (scan) {
-        ret = make_node(scan->value, nullptr);
-        scan = scan->next;
-      } else {
-        while (rotate) {
-          ret = make_node(rotate->value, std::move(ret));
-          rotate = rotate->next;
-        }
+  static index make_stream(index scan, index rotate) {
+    return streams().make(scan, rotate);
+  }
+
+  static index next(index st) {
+    stream_type &s = streams()[st];
+    index ret = null;
+    if (s.scan != null) {
+      const node_type &n = nodes()[s.scan];
+      ret = make_node(n.value, null);
+      s.scan = n.next;
+    } else {
+      while (s.rotate != null) {
+        const node_type &n = nodes()[s.rotate];
+        ret = make_node(n.value, ret);
+        s.rotate = n.next;
       }
-      return ret;
     }
-  };
+    return ret;
+  }
 
-  node_ptr f_st;
-  raw_ptr proc;
-  stream_ptr stream;
-  node_ptr b_st;
+  index f_st;
+  index proc;
+  index stream;
+  index b_st;
 
-  explicit persistent_queue(stream_ptr &&st)
-      : f_st(st->next()), proc(f_st.get()), stream(std::move(st)), b_st() {}
+  explicit persistent_queue(index st)
+      : f_st(next(st)), proc(f_st), stream(st), b_st(null) {}
 
-  template <class Bptr>
-  explicit persistent_queue(const node_ptr &f, const raw_ptr &p,
-                            const stream_ptr &s, Bptr &&b)
-      : f_st(f), proc(p), stream(s), b_st(std::forward<Bptr>(b)) {}
+  explicit persistent_queue(index f, index p, index s, index b)
+      : f_st(f), proc(p), stream(s), b_st(b) {}
 
 public:
-  persistent_queue() : f_st(), proc(nullptr), stream(), b_st() {}
+  persistent_queue() : f_st(null), proc(null), stream(null), b_st(null) {}
 
-  const T &front() const { return f_st->value; }
+  const T &front() const { return nodes()[f_st].value; }
 
   Self push(T x) const {
-    if (!proc)
+    if (proc == null)
       return Self(make_stream(f_st, make_node(std::move(x), b_st)));
-    if (!proc->next)
-      proc->next = stream->next();
-    return Self(f_st, proc->next.get(), stream, make_node(std::move(x), b_st));
+    if (nodes()[proc].next == null)
+      nodes()[proc].next = next(stream);
+    return Self(f_st, nodes()[proc].next, stream, make_node(std::move(x), b_st));
   }
 
   Self pop() const {
-    if (!proc)
-      return Self(make_stream(f_st->next, b_st));
-    if (!proc->next)
-      proc->next = stream->next();
-    return Self(f_st->next, proc->next.get(), stream, b_st);
+    if (proc == null)
+      return Self(make_stream(nodes()[f_st].next, b_st));
+    if (nodes()[proc].next == null)
+      nodes()[proc].next = next(stream);
+    return Self(nodes()[f_st].next, nodes()[proc].next, stream, b_st);
   }
 };
 
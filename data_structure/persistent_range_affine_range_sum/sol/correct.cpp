@@ -7,6 +7,9 @@
 #include <utility>
 
 #include <cassert>
+
+#include "arena.h"
+
 namespace nachia{
 
 // ax + by = gcd(a,b)
@@ -81,16 +84,18 @@ template<
 >
 struct PersistentLazySegtree {
 public:
+    using Index = unsigned int;
     struct Node {
-        int l;
-        int r;
+        Index l; // null at leaves
+        Index r;
         S a;
         F f;
     };
+    static constexpr Index null = library_checker::Pool<Node>::null;
     struct Agent{
     public:
         Agent(){}
-        Agent(int _sz, int _root, PersistentLazySegtree* _q) : sz(_sz), root(_root), q(_q) {}
+        Agent(int _sz, Index _root, PersistentLazySegtree* _q) : sz(_sz), root(_root), q(_q) {}
         int size() const { return sz; }
         Agent set(int at, S x) const { return copy(q->set(root,sz,at,x,q->id)); }
         S prod(int l, int r) const { return q->prod(root,sz,l,r,q->id); }
@@ -100,45 +105,39 @@ public:
         }
     private:
         int sz;
-        int root;
+        Index root;
         PersistentLazySegtree* q = nullptr;
-        Agent copy(int newRoot) const { return Agent(sz, newRoot, q); }
+        Agent copy(Index newRoot) const { return Agent(sz, newRoot, q); }
     };
 
     PersistentLazySegtree(){}
 
-    PersistentLazySegtree(S _e, F _id, int reserved_size = 0)
-        : e(_e), id(_id) { v.reserve(reserved_size); }
+    PersistentLazySegtree(S _e, F _id)
+        : e(_e), id(_id) {}
 
     Agent construct(const std::vector<S>& val){
         return { int(val.size()), fromRange(val.begin(), int(val.size())), this };
     }
 
 private:
-    int newLeaf(S x){
-        int res = v.size();
-        v.push_back({ -1, -1, x, id });
-        return res;
+    Index newLeaf(S x){
+        return v.make(Node{ null, null, x, id });
     }
-    int newMid(int l, int r){
-        int res = v.size();
-        v.push_back({ l, r, op(v[l].a, v[r].a), id });
-        return res;
+    Index newMid(Index l, Index r){
+        return v.make(Node{ l, r, op(v[l].a, v[r].a), id });
     }
-    int applyAtNode(int p, F f){
-        if(v[p].l == -1) return newLeaf(mapping(f, v[p].a));
-        int res = v.size();
-        v.push_back({ v[p].l, v[p].r, mapping(f, v[p].a), composition(f, v[p].f) });
-        return res;
+    Index applyAtNode(Index p, F f){
+        if(v[p].l == null) return newLeaf(mapping(f, v[p].a));
+        return v.make(Node{ v[p].l, v[p].r, mapping(f, v[p].a), composition(f, v[p].f) });
     }
-    int set(int p, int n, int at, S x, F prop){
+    Index set(Index p, int n, int at, S x, F prop){
         if(n == 1) return newLeaf(x);
         int m = n / 2;
         auto nxf = composition(prop, v[p].f);
         if(at < m) return newMid(set(v[p].l, m, at, x, nxf), applyAtNode(v[p].r, nxf));
         return newMid(applyAtNode(v[p].l, nxf), set(v[p].r, n-m, at-m, x, nxf));
     }
-    S prod(int p, int n, int l, int r, F prop){
+    S prod(Index p, int n, int l, int r, F prop){
         if(l <= 0 && n <= r) return mapping(prop, v[p].a);
         if(r <= 0 || n <= l) return e;
         int m = n / 2;
@@ -148,26 +147,26 @@ private:
             prod(v[p].r, n-m, l-m, r-m, nxf)
         );
     }
-    int apply(int p, int n, int l, int r, F f, F prop){
+    Index apply(Index p, int n, int l, int r, F f, F prop){
         if(l <= 0 && n <= r) return applyAtNode(p, composition(f, prop));
         if(r <= 0 || n <= l) return applyAtNode(p, prop);
         int m = n / 2;
         auto nxf = composition(prop, v[p].f);
-        int l2 = apply(v[p].l, m, l, r, f, nxf);
-        int r2 = apply(v[p].r, n-m, l-m, r-m, f, nxf);
+        Index l2 = apply(v[p].l, m, l, r, f, nxf);
+        Index r2 = apply(v[p].r, n-m, l-m, r-m, f, nxf);
         return newMid(l2, r2);
     }
-    int crossover(int p, int q, int n, int at, F propl, F propr){
+    Index crossover(Index p, Index q, int n, int at, F propl, F propr){
         if(at <= 0) return applyAtNode(q, propr);
         if(n <= at) return applyAtNode(p, propl);
         int m = n / 2;
         auto nxfl = composition(propl, v[p].f);
         auto nxfr = composition(propr, v[q].f);
-        int l2 = crossover(v[p].l, v[q].l, m, at, nxfl, nxfr);
-        int r2 = crossover(v[p].r, v[q].r, n-m, at-m, nxfl, nxfr);
+        Index l2 = crossover(v[p].l, v[q].l, m, at, nxfl, nxfr);
+        Index r2 = crossover(v[p].r, v[q].r, n-m, at-m, nxfl, nxfr);
         return newMid(l2, r2);
     }
-    int fromRange(typename std::vector<S>::const_iterator a, int n){
+    Index fromRange(typename std::vector<S>::const_iterator a, int n){
         if(n == 1) return newLeaf(a[0]);
         int m = n / 2;
         return newMid(fromRange(a, m), fromRange(a+m, n-m));
@@ -175,7 +174,8 @@ private:
 
     S e;
     F id;
-    std::vector<Node> v;
+    // every version shares these nodes, and none is freed
+    library_checker::Pool<Node> v;
 };
 
 } // namespace nachia
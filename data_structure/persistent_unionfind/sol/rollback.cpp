@@ -0,0 +1,55 @@
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "persistent_unionfind.h"
+
+using namespace std;
+using namespace library_checker;
+
+// offline: DFS on the tree of versions with an explicit stack, undoing the
+// merge of a version when it is left
+int main() {
+    int n, q;
+    scanf("%d %d", &n, &q);
+    // query i is node i + 1 and its parent is k + 1, node 0 is G_{-1}
+    vector<int> t(q + 1, 0), u(q + 1), v(q + 1), parent(q + 1, -1);
+    for (int i = 1; i <= q; i++) {
+        int k;
+        scanf("%d %d %d %d", &t[i], &k, &u[i], &v[i]);
+        parent[i] = k + 1;
+    }
+    vector<int> start(q + 2), child(q);
+    for (int i = 1; i <= q; i++) start[parent[i] + 1]++;
+    for (int i = 0; i <= q; i++) start[i + 1] += start[i];
+    {
+        vector<int> pos(start.begin(), start.end() - 1);
+        for (int i = 1; i <= q; i++) child[pos[parent[i]]++] = i;
+    }
+
+    RollbackUnionFind uf(n);
+    vector<int> ans(q + 1, -1), snap(q + 1);
+    // ~x means leaving x
+    vector<int> st = {0};
+    while (!st.empty()) {
+        int x = st.back();
+        st.pop_back();
+        if (x < 0) {
+            uf.rollback(snap[~x]);
+            continue;
+        }
+        if (x > 0 && t[x] == 1) {
+            ans[x] = uf.same(u[x], v[x]);
+            continue;
+        }
+        snap[x] = uf.snapshot();
+        if (x > 0) uf.merge(u[x], v[x]);
+        st.push_back(~x);
+        for (int i = start[x]; i < start[x + 1]; i++) st.push_back(child[i]);
+    }
+
+    for (int i = 1; i <= q; i++) {
+        if (t[i] == 1) printf("%d\n", ans[i]);
+    }
+    return 0;
+}
@@ -8,6 +8,8 @@
 #include <cassert>
 #include <functional>
 
+#include "arena.h"
+
 using namespace std;
 
 using ll = long long;
@@ -69,27 +71,18 @@ struct Dynamic_Lazy_SegTree {
     A lazy;
   };
 
-  const int NODES;
   const ll L0, R0;
-  Node *pool;
-  int pid;
+  library_checker::Pool<Node> pool;
   using np = Node *;
 
   Dynamic_Lazy_SegTree(
-      int NODES, ll L0, ll R0, F default_prod = [](ll, ll) -> X { return MX::unit(); })
-      : default_prod(default_prod), NODES(NODES), L0(L0), R0(R0), pid(0) {
-    pool = new Node[NODES];
-  }
-  ~Dynamic_Lazy_SegTree() { delete[] pool; }
+      ll L0, ll R0, F default_prod = [](ll, ll) -> X { return MX::unit(); })
+      : default_prod(default_prod), L0(L0), R0(R0), pool(true) {}
 
   np new_root() { return new_node(L0, R0); }
 
   np new_node(const X x) {
-    assert(pid < NODES);
-    pool[pid].l = pool[pid].r = nullptr;
-    pool[pid].x = x;
-    pool[pid].lazy = MA::unit();
-    return &(pool[pid++]);
+    return pool.make_ptr(Node{nullptr, nullptr, x, MA::unit()});
   }
 
   np new_node(ll l, ll r) {
@@ -115,7 +108,7 @@ struct Dynamic_Lazy_SegTree {
 
   X prod(np root, ll l, ll r) {
     if (l == r || !root) return MX::unit();
-    assert(pid && L0 <= l && l < r && r <= R0);
+    assert(pool.size() > 1 && L0 <= l && l < r && r <= R0);
     X x = MX::unit();
     prod_rec(root, L0, R0, l, r, x, MA::unit());
     return x;
@@ -124,31 +117,31 @@ struct Dynamic_Lazy_SegTree {
   X prod_all(np root) { return prod(root, L0, R0); }
 
   np set(np root, ll i, const X &x) {
-    assert(pid && L0 <= i && i < R0);
+    assert(pool.size() > 1 && L0 <= i && i < R0);
     return set_rec(root, L0, R0, i, x);
   }
 
   np multiply(np root, ll i, const X &x) {
-    assert(pid && L0 <= i && i < R0);
+    assert(pool.size() > 1 && L0 <= i && i < R0);
     return multiply_rec(root, L0, R0, i, x);
   }
 
   np apply(np root, ll l, ll r, const A &a) {
     if (l == r) return root;
-    assert(pid && L0 <= l && l < r && r <= R0);
+    assert(pool.size() > 1 && L0 <= l && l < r && r <= R0);
     return apply_rec(root, L0, R0, l, r, a);
   }
 
   template <typename F>
   ll max_right(np root, F check, ll L) {
-    assert(pid && L0 <= L && L <= R0 && check(MX::unit()));
+    assert(pool.size() > 1 && L0 <= L && L <= R0 && check(MX::unit()));
     X x = MX::unit();
     return max_right_rec(root, check, L0, R0, L, x);
   }
 
   template <typename F>
   ll min_left(np root, F check, ll R) {
-    assert(pid && L0 <= R && R <= R0 && check(MX::unit()));
+    assert(pool.size() > 1 && L0 <= R && R <= R0 && check(MX::unit()));
     X x = MX::unit();
     return min_left_rec(root, check, L0, R0, R, x);
   }
@@ -170,7 +163,7 @@ struct Dynamic_Lazy_SegTree {
     dfs(dfs, root, L0, R0, MA::unit());
   }
 
-  void reset() { pid = 0; }
+  void reset() { pool.clear(); }
 
   // root[l:r) を apply(other[l:r),a) で上書きしたものを返す
   np copy_interval(np root, np other, ll l, ll r, A a) {
@@ -183,10 +176,7 @@ struct Dynamic_Lazy_SegTree {
 private:
   np copy_node(np c) {
     if (!c || !PERSISTENT) return c;
-    pool[pid].l = c->l, pool[pid].r = c->r;
-    pool[pid].x = c->x;
-    pool[pid].lazy = c->lazy;
-    return &(pool[pid++]);
+    return pool.make_ptr(*c);
   }
 
   void prop(np c, ll l, ll r) {
@@ -410,7 +400,7 @@ int get() {
 
 void solve() {
   int N = get(), Q = get();
-  Dynamic_Lazy_SegTree<ActedMonoid_Sum_Affine<mint>, false> seg(120 * Q, 0, N);
+  Dynamic_Lazy_SegTree<ActedMonoid_Sum_Affine<mint>, false> seg(0, N);
   auto root = seg.new_root();
 
   FOR(Q) {
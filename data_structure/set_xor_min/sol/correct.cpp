@@ -3,6 +3,8 @@
 #include <assert.h>
 #include <set>
 
+#include "arena.h"
+
 int ri() {
 	int n;
 	scanf("%d", &n);
@@ -15,13 +17,12 @@ struct Trie {
 		Node *ch[2] = {NULL, NULL};
 		int count = 0;
 	};
-	static Node *nodes;
-	static int head;
+	static library_checker::Pool<Node> nodes;
 	Node *root = NULL;
 	void insert(u32 n) {
 		Node **cur = &root;
 		for (int i = 29; ; i--) {
-			if (!*cur) *cur = nodes + head++;
+			if (!*cur) *cur = nodes.make_ptr();
 			(*cur)->count++;
 			if (i <= -1) break;
 			cur = (*cur)->ch + (n >> i & 1);
@@ -43,8 +44,8 @@ struct Trie {
 		return res;
 	}
 };
-Trie::Node *Trie::nodes = new Node[20000000];
-int Trie::head = 1;
+// up to 31 nodes per insertion, accessed at random
+library_checker::Pool<Trie::Node> Trie::nodes(true);
 
 int main() {
 	int q = ri();
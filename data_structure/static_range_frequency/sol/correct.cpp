@@ -1,13 +1,14 @@
 #include <algorithm>
 #include <cstdio>
-#include <map>
 #include <vector>
 
+#include "hash_map.h"
+
 int main() {
   int N, Q;
   std::scanf("%d%d", &N, &Q);
 
-  std::map<int, std::vector<int>> map;
+  library_checker::HashMap<int, std::vector<int>> map;
   for (int i = 0; i < N; i++) {
     int a;
     std::scanf("%d", &a);
@@ -17,9 +18,10 @@ int main() {
   for (int i = 0; i < Q; i++) {
     int l, r, x;
     std::scanf("%d%d%d", &l, &r, &x);
-    const std::vector<int> &v = map[x];
-    const int ans = std::lower_bound(v.begin(), v.end(), r) -
-                    std::lower_bound(v.begin(), v.end(), l);
+    const std::vector<int> *v = map.find(x);
+    const int ans = v ? std::lower_bound(v->begin(), v->end(), r) -
+                            std::lower_bound(v->begin(), v->end(), l)
+                      : 0;
     std::printf("%d\n", ans);
   }
 
@@ -1,50 +1,34 @@
+#include <cstdio>
+#include <utility>
 #include <vector>
-#include <iostream>
 
-using namespace std;
-using uint = unsigned int;
-using ll = long long;
-using ull = unsigned long long;
-constexpr ll TEN(int n) { return (n == 0) ? 1 : 10 * TEN(n - 1); }
-template <class T> using V = vector<T>;
-template <class T> using VV = V<V<T>>;
+#include "unionfind.h"
 
-struct UnionFind {
-    V<int> p, r;
-    int gn;
-    UnionFind(int n = 0) : p(n, -1), r(n, 1), gn(n) {}
-    void merge(int a, int b) {
-        int x = group(a), y = group(b);
-        if (x == y) return;  // same
-        gn--;
-        if (r[x] < r[y]) {
-            p[x] = y;
-        } else {
-            p[y] = x;
-            if (r[x] == r[y]) r[x]++;
-        }
-    }
-    int group(int a) {
-        if (p[a] == -1) return a;
-        return p[a] = group(p[a]);
-    }
-    bool same(int a, int b) { return group(a) == group(b); }
-};
+using namespace std;
+using namespace library_checker;
 
 int main() {
-
-
     int n, q;
     scanf("%d %d", &n, &q);
-    UnionFind uf(n);
+    vector<int> ty(q);
+    vector<pair<int, int>> qs(q);
     for (int i = 0; i < q; i++) {
-        int ty, a, b;
-        scanf("%d %d %d", &ty, &a, &b);
-        if (ty == 0) {
-            uf.merge(a, b);
+        scanf("%d %d %d", &ty[i], &qs[i].first, &qs[i].second);
+    }
+
+    UnionFind uf(n);
+    // runs of the same type are handed over as one batch
+    vector<pair<int, int>> batch;
+    for (int i = 0; i < q;) {
+        int j = i;
+        while (j < q && ty[j] == ty[i]) j++;
+        batch.assign(qs.begin() + i, qs.begin() + j);
+        if (ty[i] == 0) {
+            uf.merge_all(batch);
         } else {
-            printf("%d\n", int(uf.same(a, b)));
+            for (char res : uf.same_all(batch)) printf("%d\n", int(res));
         }
+        i = j;
     }
     return 0;
 }
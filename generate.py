@@ -3,7 +3,7 @@
 import sys
 import argparse
 import platform
-from logging import basicConfig, getLogger
+from logging import Filter, LogRecord, StreamHandler, basicConfig, getLogger
 from os import getenv
 from pathlib import Path
 import sysconfig
@@ -11,21 +11,31 @@ import os
 import shutil
 import hashlib
 import json
-from datetime import datetime
+import threading
+from concurrent.futures import FIRST_EXCEPTION, Future, ThreadPoolExecutor, wait
+from contextvars import ContextVar, copy_context
+from datetime import datetime, timedelta
+from functools import lru_cache, partial
 from difflib import unified_diff
 from subprocess import (PIPE, STDOUT, CalledProcessError,
                         TimeoutExpired, check_call, run)
 from tempfile import TemporaryDirectory
-from typing import Any, Iterator, List, MutableMapping, Optional, Union
+from typing import Any, Callable, Iterable, Iterator, List, MutableMapping, Optional, Tuple, TypeVar, Union
 
 from enum import Enum
 import toml
 
 logger = getLogger(__name__)
 
+# name of the problem the current job belongs to, for log records
+current_problem: ContextVar[str] = ContextVar('current_problem', default='')
+
 CASENAME_LEN_LIMIT = 40
 STACK_SIZE = 2 ** 28  # 256 MB
 
+T = TypeVar('T')
+R = TypeVar('R')
+
 
 def casename(name: Union[str, Path], i: int) -> str:
     """(random, 1) -> random_01"""
@@ -55,31 +65,94 @@ def find_problem_dir(rootdir: Path, problem_name: Path) -> Optional[Path]:
     return tomls[0].parent
 
 
-def compile(src: Path, rootdir: Path, opts: List[str] = []):
+def compile_command(rootdir: Path) -> List[str]:
+    """compiler and flags used for .cpp files, without input and output"""
+    # use clang for msys2 clang environment
+    if os.name == 'nt' and sysconfig.get_platform().startswith('mingw') and sysconfig.get_platform().endswith('clang'):
+        cxx = getenv('CXX', 'clang++')
+    else:
+        cxx = getenv('CXX', 'g++')
+    cxxflags_default = '-O2 -std=c++17 -Wall -Wextra -Werror -Wno-unused-result'
+    if platform.system() == 'Darwin':
+        cxxflags_default += ' -Wl,-stack_size,{}'.format(hex(STACK_SIZE))
+    if platform.system() == 'Windows':
+        cxxflags_default += ' -Wl,-stack,{}'.format(hex(STACK_SIZE))
+        # avoid using MinGW's "unique" stdio, which doesn't recognize %lld
+        cxxflags_default += ' -D__USE_MINGW_ANSI_STDIO'
+        # avoid CI issue, ref https://github.com/yosupo06/library-checker-problems/issues/1031
+        cxxflags_default += ' -static'
+    if platform.uname().system == 'Linux' and 'microsoft' in platform.uname().release.lower():
+        # a workaround for the lack of ulimit in Windows Subsystem for Linux
+        cxxflags_default += ' -fsplit-stack'
+    cxxflags = getenv('CXXFLAGS', cxxflags_default).split()
+    cxxflags.extend(['-I', str(rootdir / 'common')])
+    return [cxx] + cxxflags
+
+
+@lru_cache(maxsize=None)
+def compiler_version(cxx: str) -> str:
+    """output of `cxx --version`, this distinguishes compilers with the same name"""
+    return run([cxx, '--version'], stdout=PIPE, stderr=STDOUT).stdout.decode('utf-8', 'replace')
+
+
+pch_lock = threading.Lock()
+
+
+def testlib_pch(rootdir: Path) -> Path:
+    """
+    precompile common/testlib.h once per compiler / flags / testlib.h and return the path of the header.
+    the precompiled header is put next to it, so `-include` of the returned path picks it up
+    """
+    command = compile_command(rootdir)
+    testlib = rootdir / 'common' / 'testlib.h'
+    m = hashlib.sha256()
+    m.update(compiler_version(command[0]).encode())
+    m.update(' '.join(command[1:]).encode())
+    m.update(testlib.read_bytes())
+    pchdir = rootdir / '.pch' / m.hexdigest()[:16]
+    header = pchdir / 'testlib.h'
+    # gcc looks for .gch, clang looks for .pch
+    suffix = '.pch' if 'clang' in compiler_version(command[0]) else '.gch'
+    with pch_lock:
+        if not header.exists():
+            logger.info('precompile testlib.h')
+            pchdir.mkdir(parents=True, exist_ok=True)
+            start = datetime.now()
+            tmp = pchdir / ('testlib.h{}.{}'.format(suffix, os.getpid()))
+            check_call(command + ['-x', 'c++-header', '-o', str(tmp), str(testlib)])
+            tmp.replace(pchdir / ('testlib.h' + suffix))
+            shutil.copy(testlib, header)
+            record_compile_time('testlib.h (pch)', datetime.now() - start)
+    return header
+
+
+compile_times: MutableMapping[str, List[float]] = dict()
+compile_times_lock = threading.Lock()
+
+
+def record_compile_time(kind: str, elapsed: timedelta):
+    with compile_times_lock:
+        compile_times.setdefault(kind, []).append(elapsed.total_seconds())
+
+
+def logging_compile_times():
+    for kind, times in sorted(compile_times.items()):
+        logger.info('compile time: {:>16s} {:4d} files {:8.2f} secs (avg {:.2f} secs)'.format(
+            kind, len(times), sum(times), sum(times) / len(times)))
+
+
+def compile(src: Path, rootdir: Path, opts: List[str] = [], use_pch: bool = False):
     if src.suffix == '.cpp':
-        # use clang for msys2 clang environment
-        if os.name == 'nt' and sysconfig.get_platform().startswith('mingw') and sysconfig.get_platform().endswith('clang'):
-            cxx = getenv('CXX', 'clang++')
-        else:
-            cxx = getenv('CXX', 'g++')
-        cxxflags_default = '-O2 -std=c++17 -Wall -Wextra -Werror -Wno-unused-result'
-        if platform.system() == 'Darwin':
-            cxxflags_default += ' -Wl,-stack_size,{}'.format(hex(STACK_SIZE))
-        if platform.system() == 'Windows':
-            cxxflags_default += ' -Wl,-stack,{}'.format(hex(STACK_SIZE))
-            # avoid using MinGW's "unique" stdio, which doesn't recognize %lld
-            cxxflags_default += ' -D__USE_MINGW_ANSI_STDIO'
-            # avoid CI issue, ref https://github.com/yosupo06/library-checker-problems/issues/1031
-            cxxflags_default += ' -static'
-        if platform.uname().system == 'Linux' and 'microsoft' in platform.uname().release.lower():
-            # a workaround for the lack of ulimit in Windows Subsystem for Linux
-            cxxflags_default += ' -fsplit-stack'
-        cxxflags = getenv('CXXFLAGS', cxxflags_default).split()
-        cxxflags.extend(['-I', str(rootdir / 'common')])
-        args = [cxx] + cxxflags + \
-            ['-o', str(src.with_suffix(''))] + opts + [str(src)]
+        pch_opts: List[str] = []
+        if use_pch and '#include "testlib.h"' in src.read_text(errors='replace'):
+            pch_opts = ['-include', str(testlib_pch(rootdir))]
+        args = compile_command(rootdir) + \
+            ['-o', str(src.with_suffix(''))] + pch_opts + opts + [str(src)]
         logger.debug('compile: %s', args)
+        start = datetime.now()
         check_call(args)
+        kind = src.name if src.name in ['checker.cpp', 'verifier.cpp'] else 'others'
+        record_compile_time(kind, datetime.now() - start)
     elif src.suffix == '.in':
         pass
     elif src.suffix == '.py':
@@ -128,6 +201,57 @@ def check_call_to_file(command: List[str], outpath: Path, *args, **kwargs):
                     outfile.write(line)
 
 
+class Scheduler:
+    """
+    Runs independent jobs (compiles, generators, solutions, checkers) on a
+    shared pool of worker threads. All problems share one queue, so idle
+    workers pick up cases of any problem.
+    A job that calls map() from inside a worker runs its children inline,
+    so nested calls never wait for a free worker: jobs that should run in
+    parallel have to be passed to one map().
+    """
+
+    def __init__(self, jobs: int = 1):
+        self.executor = ThreadPoolExecutor(jobs) if jobs > 1 else None
+        self.in_worker: ContextVar[bool] = ContextVar('in_worker', default=False)
+
+    def map(self, fn: Callable[[T], R], items: Iterable[T]) -> List[R]:
+        """
+        same as list(map(fn, items)), results are in the order of items
+        the first failed job cancels the pending ones and its exception is raised
+        """
+        if self.executor is None or self.in_worker.get():
+            return [fn(item) for item in items]
+
+        def run(item: T) -> R:
+            self.in_worker.set(True)
+            return fn(item)
+
+        # each job runs in a copy of the caller's context (current_problem)
+        futures = [self.executor.submit(copy_context().run, run, item)
+                   for item in items]
+        return wait_all(futures)
+
+    def shutdown(self):
+        """cancel all pending jobs, running ones are not interrupted"""
+        if self.executor is not None:
+            self.executor.shutdown(wait=False, cancel_futures=True)
+
+
+def wait_all(futures: List['Future[R]']) -> List[R]:
+    """
+    results of futures in order, or the first exception raised by them
+    once one of them fails, the others which haven't started are cancelled
+    """
+    done, pending = wait(futures, return_when=FIRST_EXCEPTION)
+    for future in pending:
+        future.cancel()
+    for future in futures:
+        if future in done and not future.cancelled() and future.exception() is not None:
+            future.result()
+    return [future.result() for future in futures]
+
+
 def logging_result(result: str, start: datetime, end: datetime, message: str):
     elapsed_millis = (end - start).seconds*1000 + \
         (end - start).microseconds // 1000
@@ -157,6 +281,9 @@ class Problem:
     rootdir: Path  # /path/to/librar-checker-problems
     basedir: Path  # /path/to/librar-checker-problems/sample/aplusb
     ignore_warning: bool = False
+    scheduler: Scheduler = Scheduler()
+    cache_dir: Optional[Path] = None  # see restore_from_cache
+    use_pch: bool = False  # compile checker / verifier with precompiled testlib.h
 
     config: MutableMapping[str, Any]
     checker: Path
@@ -218,25 +345,29 @@ class Problem:
 
     def compile_verifier(self):
         logger.info('compile verifier')
-        compile(self.verifier, self.rootdir)
+        compile(self.verifier, self.rootdir, use_pch=self.use_pch)
 
-    def compile_gens(self):
-        logger.info('compile generators')
-        for test in self.config['tests']:
-            name = test['name']
-            logger.info('compile {}'.format(name))
-            compile(self.basedir / 'gen' / name, self.rootdir)
+    def compile_gen(self, name: str):
+        logger.info('compile {}'.format(name))
+        compile(self.basedir / 'gen' / name, self.rootdir)
 
     def compile_checker(self):
         logger.info('compile checker')
-        compile(self.checker, self.rootdir)
+        compile(self.checker, self.rootdir, use_pch=self.use_pch)
+
+    def compile_solution(self, sol: MutableMapping[str, Any]):
+        """sol: an entry of solutions in info.toml, linked with the grader if function = true"""
+        name = sol['name']
+        opts = [str(self.basedir / 'grader' / 'grader.cpp'), '-I',
+                str(self.basedir / 'grader')] if sol.get('function', False) else []
+        compile(self.basedir / 'sol' / name, self.rootdir, opts)
 
     def compile_solutions(self):
-        for sol in self.config.get('solutions', []):
-            name = sol['name']
-            opts = [str(self.basedir / 'grader' / 'grader.cpp'), '-I',
-                    str(self.basedir / 'grader')] if sol.get('function', False) else []
-            compile(self.basedir / 'sol' / name, self.rootdir, opts)
+        self.scheduler.map(self.compile_solution, self.config.get('solutions', []))
+
+    def list_cases(self) -> List[Tuple[str, int]]:
+        """[(name of generator, seed)] of all testcases"""
+        return [(test['name'], i) for test in self.config['tests'] for i in range(test['number'])]
 
     def check_all_solutions_used(self) -> bool:
         sol_names: set[str] = set()
@@ -259,30 +390,32 @@ class Problem:
         indir.mkdir()
 
         for test in self.config['tests']:
-            name = test['name']
-            num = test['number']
+            logger.info('gen {} {}cases'.format(test['name'], test['number']))
 
-            logger.info('gen {} {}cases'.format(name, num))
-            for i in range(num):
-                inpath = indir / (casename(name, i) + '.in')
-                check_call_to_file(execcmd(gendir / name, [str(i)]), inpath)
+        def gen_case(case: Tuple[str, int]):
+            name, i = case
+            inpath = indir / (casename(name, i) + '.in')
+            check_call_to_file(execcmd(gendir / name, [str(i)]), inpath)
+        self.scheduler.map(gen_case, self.list_cases())
 
     def verify_inputs(self):
         indir = self.basedir / 'in'
 
         for test in self.config['tests']:
-            name = test['name']
-            num = test['number']
-            logger.info('verify {} {}cases'.format(name, num))
-            for i in range(num):
-                inname = (casename(name, i) + '.in')
-                inpath = indir / inname
-                with open(str(inpath), 'r') as infile:
-                    result = run(execcmd(self.verifier),
-                                 stdin=infile)
-                if result.returncode != 0:
-                    logger.error('verify failed: {}'.format(inname))
-                    exit(1)
+            logger.info('verify {} {}cases'.format(
+                test['name'], test['number']))
+
+        def verify_case(case: Tuple[str, int]) -> int:
+            name, i = case
+            inpath = indir / (casename(name, i) + '.in')
+            with open(str(inpath), 'r') as infile:
+                return run(execcmd(self.verifier), stdin=infile).returncode
+        cases = self.list_cases()
+        for (name, i), returncode in zip(cases, self.scheduler.map(verify_case, cases)):
+            if returncode != 0:
+                logger.error('verify failed: {}'.format(
+                    casename(name, i) + '.in'))
+                exit(1)
 
     def make_outputs(self, check: bool):
         indir = self.basedir / 'in'
@@ -295,27 +428,25 @@ class Problem:
             shutil.rmtree(str(outdir))
         outdir.mkdir()
 
-        for test in self.config['tests']:
-            name = test['name']
-            num = test['number']
-
-            for i in range(num):
-                case = casename(name, i)
-                inpath = indir / (case + '.in')
-                expected = outdir / (case + '.out')
-                start = datetime.now()
-                with open(str(inpath), 'r') as infile:
-                    check_call_to_file(execcmd(soldir / 'correct.cpp'),
-                                       expected, stdin=infile)
-                end = datetime.now()
-                checker_output = bytes()
-                if check:
-                    process = run(
-                        execcmd(checker, [str(inpath), str(expected), str(expected)]), stdout=PIPE, stderr=STDOUT, check=True)
-                    checker_output = process.stdout
-
-                logging_result('ANS', start, end,
-                               '{} : {}'.format(case, checker_output))
+        def make_output(case: str) -> Tuple[datetime, datetime, bytes]:
+            inpath = indir / (case + '.in')
+            expected = outdir / (case + '.out')
+            start = datetime.now()
+            with open(str(inpath), 'r') as infile:
+                check_call_to_file(execcmd(soldir / 'correct.cpp'),
+                                   expected, stdin=infile)
+            end = datetime.now()
+            checker_output = bytes()
+            if check:
+                process = run(
+                    execcmd(checker, [str(inpath), str(expected), str(expected)]), stdout=PIPE, stderr=STDOUT, check=True)
+                checker_output = process.stdout
+            return start, end, checker_output
+
+        cases = [casename(name, i) for name, i in self.list_cases()]
+        for case, (start, end, checker_output) in zip(cases, self.scheduler.map(make_output, cases)):
+            logging_result('ANS', start, end,
+                           '{} : {}'.format(case, checker_output))
 
     def is_testcases_already_generated(self) -> bool:
         indir = self.basedir / 'in'
@@ -347,10 +478,14 @@ class Problem:
         logger.info('Test cases are already generated')
         return True
 
-    def is_checker_already_generated(self) -> bool:
+    def checker_binary(self) -> Path:
         checker_bin = self.checker.parent / self.checker.stem
         if platform.system() == 'Windows':
             checker_bin = checker_bin.with_suffix('.exe')
+        return checker_bin
+
+    def is_checker_already_generated(self) -> bool:
+        checker_bin = self.checker_binary()
         if not checker_bin.exists():
             return False
 
@@ -387,6 +522,59 @@ class Problem:
             all_hash.update(h)
         return all_hash.hexdigest()
 
+    # return the key of this problem in the cache, it changes if any source, compiler or flag changes
+    def cache_key(self) -> str:
+        command = compile_command(self.rootdir)
+        m = hashlib.sha256()
+        m.update(self.problem_version().encode())
+        m.update(platform.system().encode())
+        m.update(compiler_version(command[0]).encode())
+        # -I <rootdir>/common depends on the location of the repository
+        m.update(' '.join(command[1:-2]).encode())
+        return m.hexdigest()
+
+    def cache_path(self) -> Path:
+        assert self.cache_dir is not None
+        return self.cache_dir / self.basedir.name / self.cache_key()
+
+    def restore_from_cache(self) -> bool:
+        """
+        copy in/, out/ and the checker binary from the cache.
+        the cache is keyed by cache_key(), so it never returns stale testcases
+        """
+        cache = self.cache_path()
+        if not cache.exists():
+            return False
+        logger.info('Restore from cache {}'.format(cache))
+        self.clean()
+        # shutil.copy doesn't keep mtime, so the restored files are newer than sources
+        shutil.copytree(cache / 'in', self.basedir / 'in',
+                        copy_function=shutil.copy)
+        shutil.copytree(cache / 'out', self.basedir / 'out',
+                        copy_function=shutil.copy)
+        shutil.copy(cache / self.checker_binary().name, self.checker_binary())
+        return True
+
+    def store_to_cache(self):
+        cache = self.cache_path()
+        if cache.exists():
+            return
+        logger.info('Store to cache {}'.format(cache))
+        cache.parent.mkdir(parents=True, exist_ok=True)
+        # write to a temporary directory and rename it, other processes never see a partial entry
+        with TemporaryDirectory(dir=str(cache.parent)) as tmpdir:
+            tmp = Path(tmpdir) / 'entry'
+            tmp.mkdir()
+            shutil.copytree(self.basedir / 'in', tmp / 'in')
+            shutil.copytree(self.basedir / 'out', tmp / 'out')
+            shutil.copy(self.checker_binary(), tmp)
+            try:
+                tmp.rename(cache)
+            except OSError:
+                # another process stored the same entry
+                if not cache.exists():
+                    raise
+
     def judge(self, src: Path, config: dict):
         indir = self.basedir / 'in'
         outdir = self.basedir / 'out'
@@ -397,40 +585,38 @@ class Problem:
 
         logger.info('Start {}'.format(src.name))
 
-        for test in self.config['tests']:
-            name = test['name']
-            num = test['number']
+        def judge_case(case: str) -> Tuple[str, datetime, datetime, bytes]:
+            inpath = indir / (case + '.in')
+            expected = outdir / (case + '.out')
+            actual = Path(tmpdir) / (case + '.out')
 
-            for i in range(num):
-                case = casename(name, i)
-                inpath = indir / (case + '.in')
-                expected = outdir / (case + '.out')
-                actual = Path(tmpdir) / (case + '.out')
-
-                start = datetime.now()
-                result = ''
-                checker_output = bytes()
-                try:
-                    with open(str(inpath), 'r') as infile:
-                        check_call_to_file(execcmd(src), actual,
-                                           stdin=infile, timeout=self.config['timelimit'])
-                except TimeoutExpired:
-                    result = 'TLE'
-                except CalledProcessError:
-                    result = 'RE'
+            start = datetime.now()
+            result = ''
+            checker_output = bytes()
+            try:
+                with open(str(inpath), 'r') as infile:
+                    check_call_to_file(execcmd(src), actual,
+                                       stdin=infile, timeout=self.config['timelimit'])
+            except TimeoutExpired:
+                result = 'TLE'
+            except CalledProcessError:
+                result = 'RE'
+            else:
+                process = run(
+                    execcmd(checker, [str(inpath), str(actual), str(expected)]), stdout=PIPE, stderr=STDOUT)
+                checker_output = process.stdout
+                if process.returncode:
+                    result = 'WA'
                 else:
-                    process = run(
-                        execcmd(checker, [str(inpath), str(actual), str(expected)]), stdout=PIPE, stderr=STDOUT)
-                    checker_output = process.stdout
-                    if process.returncode:
-                        result = 'WA'
-                    else:
-                        result = 'AC'
-                end = datetime.now()
-
-                results.add(result)
-                logging_result(result, start, end,
-                               '{} : {}'.format(case, checker_output.decode('utf-8')))
+                    result = 'AC'
+            end = datetime.now()
+            return result, start, end, checker_output
+
+        cases = [casename(name, i) for name, i in self.list_cases()]
+        for case, (result, start, end, checker_output) in zip(cases, self.scheduler.map(judge_case, cases)):
+            results.add(result)
+            logging_result(result, start, end,
+                           '{} : {}'.format(case, checker_output.decode('utf-8')))
 
         _tmpdir.cleanup()
         expect_status: str = config.get('expect', '')  # type: ignore
@@ -510,6 +696,7 @@ class Problem:
         if mode == self.Mode.DEV:
             self.ignore_warning = True
 
+        current_problem.set(self.basedir.name)
         logger.info('Start {}'.format(self.basedir.name))
 
         # health check
@@ -526,16 +713,28 @@ class Problem:
         is_testcases_already_generated = self.is_testcases_already_generated()
         is_checker_already_generated = self.is_checker_already_generated()
 
+        if self.cache_dir is not None and not mode.force_generate() and \
+                not (is_testcases_already_generated and is_checker_already_generated):
+            if self.restore_from_cache():
+                is_testcases_already_generated = True
+                is_checker_already_generated = True
+
+        # these compiles are independent, so run them at once
+        compile_jobs: List[Callable[[], None]] = []
         if not is_checker_already_generated or mode.force_generate():
-            self.compile_checker()
+            compile_jobs.append(self.compile_checker)
+        if not is_testcases_already_generated or mode.force_generate():
+            compile_jobs.append(self.compile_correct)
+            compile_jobs.extend(partial(self.compile_gen, test['name'])
+                                for test in self.config['tests'])
+        if mode.verify():
+            compile_jobs.append(self.compile_verifier)
+        self.scheduler.map(lambda job: job(), compile_jobs)
 
         if not is_testcases_already_generated or mode.force_generate():
-            self.compile_correct()
-            self.compile_gens()
             self.make_inputs()
 
         if mode.verify():
-            self.compile_verifier()
             self.verify_inputs()
 
         if not is_testcases_already_generated or mode.force_generate():
@@ -553,21 +752,42 @@ class Problem:
         else:
             self.assert_hashes()
 
+        if self.cache_dir is not None:
+            self.store_to_cache()
 
-def main(args: List[str]):
+
+class ProblemNameFilter(Filter):
+    """prefixes records with current_problem, for logs of parallel problems"""
+
+    def filter(self, record: LogRecord) -> bool:
+        name = current_problem.get()
+        record.problem = '[{}] '.format(name) if name else ''
+        return True
+
+
+def setup_logging(problem_name: bool = False):
+    """problem_name: prefix each record with the name of its problem"""
+    fmt = "%(asctime)s [%(levelname)s] {}%(message)s".format(
+        '%(problem)s' if problem_name else '')
     try:
         import colorlog
     except ImportError:
+        handler = StreamHandler()
+        if problem_name:
+            handler.addFilter(ProblemNameFilter())
         basicConfig(
-            format="%(asctime)s [%(levelname)s] %(message)s",
+            format=fmt,
             datefmt="%H:%M:%S",
             level=getenv('LOG_LEVEL', 'INFO'),
+            handlers=[handler]
         )
         logger.warn('Please install colorlog: pip3 install colorlog')
     else:
         handler = colorlog.StreamHandler()
+        if problem_name:
+            handler.addFilter(ProblemNameFilter())
         formatter = colorlog.ColoredFormatter(
-            "%(log_color)s%(asctime)s [%(levelname)s] %(message)s",
+            "%(log_color)s" + fmt,
             datefmt="%H:%M:%S",
             log_colors={
                 'DEBUG':    'cyan',
@@ -582,6 +802,8 @@ def main(args: List[str]):
             handlers=[handler]
         )
 
+
+def main(args: List[str]):
     parser = argparse.ArgumentParser(description='Testcase Generator')
     parser.add_argument('toml', nargs='*', help='Toml File')
     parser.add_argument('-p', '--problem', nargs='*',
@@ -592,12 +814,23 @@ def main(args: List[str]):
     parser.add_argument('--clean', action='store_true', help='Clean in/out')
     parser.add_argument('--compile-checker',
                         action='store_true', help='Deprecated: Compile Checker')
+    parser.add_argument('-j', '--jobs', type=int, default=1,
+                        help='Number of parallel jobs')
+    parser.add_argument('--cache-dir', type=Path,
+                        help='Directory to store / restore generated testcases and checkers')
+    parser.add_argument('--pch', action='store_true',
+                        help='Compile checkers and verifiers with precompiled testlib.h')
 
     opts = parser.parse_args(args)
 
+    setup_logging(opts.jobs > 1)
+
     if opts.dev + opts.test + opts.clean >= 2:
         raise ValueError('at most one of --dev, --test, --clean can be used')
 
+    if opts.jobs < 1:
+        raise ValueError('--jobs must be positive')
+
     if opts.compile_checker:
         logger.warning(
             '--compile-checker is deprecated. Checker is compiled in default')
@@ -633,8 +866,28 @@ def main(args: List[str]):
     if opts.clean:
         mode = Problem.Mode.CLEAN
 
+    scheduler = Scheduler(opts.jobs)
     for problem in problems:
-        problem.generate(mode)
+        problem.scheduler = scheduler
+        problem.cache_dir = opts.cache_dir
+        problem.use_pch = opts.pch
+
+    if opts.jobs == 1:
+        for problem in problems:
+            problem.generate(mode)
+    else:
+        # each problem waits for its own cases, real work is done by the scheduler
+        with ThreadPoolExecutor(opts.jobs) as executor:
+            futures = [executor.submit(problem.generate, mode)
+                       for problem in problems]
+            try:
+                wait_all(futures)
+            except BaseException:
+                # fail fast: don't start the cases of the other problems
+                scheduler.shutdown()
+                raise
+
+    logging_compile_times()
 
 
 if __name__ == '__main__':
@@ -5,7 +5,7 @@ import json
 import colorlog
 from logging import basicConfig, getLogger
 from os import chdir, getenv
-from subprocess import run, check_output
+from subprocess import PIPE, run, check_output
 from shutil import copy
 from pathlib import Path
 from tempfile import TemporaryDirectory
@@ -80,6 +80,36 @@ class TestSuccess(unittest.TestCase):
             self.assertEqual(proc.returncode, 0)
 
 
+class TestParallel(unittest.TestCase):
+    def test_parallel_test(self):
+        with create_test_dir('simple_aplusb') as test_dir1, create_test_dir('other_checker_place') as test_dir2:
+            proc = run(['./generate.py', str(Path(test_dir1) / 'simple_aplusb/info.toml'),
+                        str(Path(test_dir2) / 'other_checker_place/info.toml'), '--test', '-j', '4'])
+            self.assertEqual(proc.returncode, 0)
+
+    def test_parallel_failed_verify(self):
+        with create_test_dir('failed_verify') as test_dir:
+            proc = run(['./generate.py', str(Path(test_dir) /
+                       'failed_verify/info.toml'), '--test', '-j', '4'])
+            self.assertNotEqual(proc.returncode, 0)
+
+    def test_parallel_failed_verify_with_others(self):
+        with create_test_dir('failed_verify') as test_dir1, create_test_dir('simple_aplusb') as test_dir2:
+            proc = run(['./generate.py', str(Path(test_dir1) / 'failed_verify/info.toml'),
+                        str(Path(test_dir2) / 'simple_aplusb/info.toml'), '--test', '-j', '4'],
+                       stderr=PIPE, universal_newlines=True)
+            self.assertNotEqual(proc.returncode, 0)
+            self.assertIn('[failed_verify] verify failed', proc.stderr)
+
+
+class TestPch(unittest.TestCase):
+    def test_pch(self):
+        with create_test_dir('simple_aplusb') as test_dir:
+            proc = run(['./generate.py', str(Path(test_dir) /
+                       'simple_aplusb/info.toml'), '--test', '--pch'])
+            self.assertEqual(proc.returncode, 0)
+
+
 class TestClean(unittest.TestCase):
     # select problem by problem id
     def test_clean(self):
@@ -260,6 +290,83 @@ class TestCacheTest(unittest.TestCase):
             self.assertNotEqual(time, in_path.stat().st_mtime_ns)
 
 
+class TestCacheDir(unittest.TestCase):
+    def test_cache_dir(self):
+        with TemporaryDirectory() as cache_dir:
+            with create_test_dir('simple_aplusb') as test_dir:
+                proc = run(['./generate.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                            '--cache-dir', cache_dir])
+                self.assertEqual(proc.returncode, 0)
+            with create_test_dir('simple_aplusb') as test_dir:
+                proc = run(['./generate.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                            '--cache-dir', cache_dir])
+                self.assertEqual(proc.returncode, 0)
+                self.assertTrue(
+                    (Path(test_dir) / 'simple_aplusb/in/random_00.in').exists())
+                self.assertTrue(
+                    (Path(test_dir) / 'simple_aplusb/checker').exists())
+                # restored from the cache, the solution is never compiled
+                self.assertFalse(
+                    (Path(test_dir) / 'simple_aplusb/sol/correct').exists())
+
+    def test_cache_dir_changed(self):
+        with TemporaryDirectory() as cache_dir:
+            with create_test_dir('simple_aplusb') as test_dir:
+                proc = run(['./generate.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                            '--cache-dir', cache_dir])
+                self.assertEqual(proc.returncode, 0)
+            with create_test_dir('simple_aplusb') as test_dir:
+                with open(Path(test_dir) / 'simple_aplusb/task.md', 'a') as f:
+                    f.write('\n')
+                proc = run(['./generate.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                            '--cache-dir', cache_dir])
+                self.assertEqual(proc.returncode, 0)
+                self.assertTrue(
+                    (Path(test_dir) / 'simple_aplusb/sol/correct').exists())
+
+
+class TestBenchmark(unittest.TestCase):
+    def test_benchmark(self):
+        with create_test_dir('simple_aplusb') as test_dir:
+            report = Path(test_dir) / 'report.json'
+            proc = run(['./benchmark.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                        '-n', '2', '-o', str(report)])
+            self.assertEqual(proc.returncode, 0)
+            results = json.loads(report.read_text())['results']
+            self.assertEqual(len(results), len(list((Path(test_dir) / 'simple_aplusb/in').glob('*.in'))))
+            self.assertTrue(all(r['status'] == 'OK' for r in results))
+
+            csv_report = Path(test_dir) / 'report.csv'
+            proc = run(['./benchmark.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                        '-o', str(csv_report), '--baseline', str(report), '--threshold', '100'])
+            self.assertEqual(proc.returncode, 0)
+            self.assertTrue(csv_report.exists())
+
+    def test_benchmark_function(self):
+        with TemporaryDirectory() as test_dir:
+            report = Path(test_dir) / 'report.json'
+            proc = run(['./benchmark.py', '-p', 'aplusb', '-s', 'ac_func.cpp',
+                        '-n', '1', '-o', str(report)])
+            self.assertEqual(proc.returncode, 0)
+            results = json.loads(report.read_text())['results']
+            self.assertTrue(results)
+            self.assertTrue(all(r['status'] == 'OK' for r in results))
+
+    def test_benchmark_regression(self):
+        with create_test_dir('simple_aplusb') as test_dir:
+            report = Path(test_dir) / 'report.json'
+            proc = run(['./benchmark.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                        '-n', '1', '-o', str(report)])
+            self.assertEqual(proc.returncode, 0)
+            data = json.loads(report.read_text())
+            for r in data['results']:
+                r['max_rss'] = 0
+            report.write_text(json.dumps(data))
+            proc = run(['./benchmark.py', str(Path(test_dir) / 'simple_aplusb/info.toml'),
+                        '-n', '1', '--baseline', str(report), '--min-rss', '0'])
+            self.assertNotEqual(proc.returncode, 0)
+
+
 class TestListDependingFiles(unittest.TestCase):
     def test_list_depending_files(self):
         problem = Problem(Path.cwd(), Path('sample/aplusb'))
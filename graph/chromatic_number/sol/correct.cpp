@@ -1,34 +1,22 @@
-#include <iostream>
-using namespace std;
-
-int es[20],dp[1<<20];
-
-int main(){
-   int n,m;
-   scanf("%d%d",&n,&m);
-   for (int _ = 0; _ < m; _++){
-      int u,v;
-      scanf("%d%d",&u,&v);
-      es[u]|=1<<v;
-      es[v]|=1<<u;
-   }
-   
-   for (int i = 0; i < (1<<n); i++){
-      dp[i]=1<<30;
-   }
-   dp[0]=1;
-   for (int i = 0; i < n; i++){
-      for (int mask = 0; mask < (1<<n); mask++){
-         if(dp[mask]==1 and (mask&es[i])==0){
-            dp[mask|(1<<i)]=1;
-         }
-      }
-   }
-   for (int mask = 0; mask < (1<<n); mask++){
-      for (int sub = mask; --sub&=mask; ){
-         dp[mask]=min(dp[mask],dp[mask^sub]+dp[sub]);
-      }
-   }
-   printf("%d\n",dp[(1<<n)-1]);
-   return 0;
-}
\ No newline at end of file
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "chromatic.h"
+
+using namespace std;
+using namespace library_checker;
+
+int main() {
+    int n, m;
+    scanf("%d %d", &n, &m);
+    vector<uint32_t> adj(n);
+    for (int i = 0; i < m; i++) {
+        int u, v;
+        scanf("%d %d", &u, &v);
+        adj[u] |= 1u << v;
+        adj[v] |= 1u << u;
+    }
+    printf("%d\n", chromatic_number(n, adj));
+    return 0;
+}
@@ -1,60 +1,60 @@
 #include <cstdio>
-#include <vector>
 #include <utility>
-#include <tuple>
-#include <stack>
-#include <functional>
-#include <algorithm>
-#include <cassert>
-using Graph = std::vector< std::vector< std::pair<int, int> > >;
+#include <vector>
 
-int main() {
-    int N, M; scanf("%d%d", &N, &M);
-    Graph G(N);
-    std::vector<int> U(M), V(M);
-    for(int i=0; i<M; i++) {
-        scanf("%d%d", &U[i], &V[i]);
-        G[ U[i] ].emplace_back(V[i], i);
-    }
+#include "graph.h"
 
-    std::vector<bool> visited(N), finished(N);
-    std::stack<int> st;
-    int base_point = -1;
-    auto dfs = [&](auto &&self, int cur) -> bool {
-        visited[cur] = true;
-        for(auto edge : G[cur]) {
-            int to, id; std::tie(to, id) = edge;
-            st.emplace(id);
-            if(visited[to] and !finished[to]) {
-                base_point = to;
-                return true;
-            }
-            if(!visited[to] and self(self, to)) return true;
-            st.pop();
+using namespace std;
+using namespace library_checker;
+
+// DFS keeping the edges of the current path; an edge to a vertex on the
+// path closes a cycle
+struct CycleFinder {
+    vector<char> visited, finished;
+    vector<int> path, cycle;
+
+    bool root(int v) { return cycle.empty() && !visited[v]; }
+    void enter(int v) { visited[v] = true; }
+    bool arc(int, const CSRGraph::Arc& a) {
+        if (!cycle.empty()) return false;
+        path.push_back(a.id);
+        if (visited[a.to] && !finished[a.to]) {
+            cycle = path;
+            return false;
         }
-        finished[cur] = true;
+        if (!visited[a.to]) return true;
+        path.pop_back();
         return false;
-    };
-    for(int i=0; i<N; i++) {
-        if(visited[i]) continue;        
-        if(dfs(dfs, i)) {
-            int v = base_point;
-            std::vector<int> ans;
-            while(st.size()) {
-                int edge = st.top(); st.pop();
-                assert(V[edge] == v);
-                ans.emplace_back(edge);
-                v = U[edge];
-                if(v == base_point) break;
-            }
-            std::reverse(ans.begin(), ans.end());
-            printf("%zu\n", ans.size());
-            for(size_t i=0; i<ans.size(); i++) {
-                printf("%d\n", ans[i]);
-            }
-            return 0;
-        }
     }
-    puts("-1");
+    void back(int, const CSRGraph::Arc&) {
+        if (cycle.empty()) path.pop_back();
+    }
+    void leave(int v) { finished[v] = true; }
+};
+
+int main() {
+    int n, m;
+    scanf("%d%d", &n, &m);
+    vector<pair<int, int>> edges(m);
+    for (auto& [u, v] : edges) {
+        scanf("%d%d", &u, &v);
+    }
+    CSRGraph g = CSRGraph::directed(n, edges);
+
+    CycleFinder finder{vector<char>(n, false), vector<char>(n, false), {}, {}};
+    g.dfs(finder);
+    if (finder.cycle.empty()) {
+        puts("-1");
+        return 0;
+    }
+    // the path ends with the edge into its own vertex base, the cycle is
+    // the suffix starting at base
+    int base = edges[finder.cycle.back()].second;
+    size_t i = finder.cycle.size();
+    while (edges[finder.cycle[i - 1]].first != base) i--;
+    printf("%zu\n", finder.cycle.size() - (i - 1));
+    for (size_t j = i - 1; j < finder.cycle.size(); j++) {
+        printf("%d\n", finder.cycle[j]);
+    }
     return 0;
 }
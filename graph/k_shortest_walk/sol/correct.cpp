@@ -2,6 +2,7 @@
 #include<vector>
 #include<tuple>
 #include<queue>
+#include "arena.h"
 using namespace::std;
 using lint=long long;
 constexpr lint INF=1LL<<60;
@@ -9,36 +10,42 @@ constexpr lint INF=1LL<<60;
 template<typename T>
 struct heap{
 	struct node{
-		node* ch[2]={0,0};
+		unsigned ch[2]={0,0};
 		int s;
 		T val;
 		int from,to;
 		node(T val,int from,int to):s(1),val(val),from(from),to(to){}
 	};
-	using np=node*;
+	// persistent: melded nodes are copied, and every version is kept
+	static library_checker::Pool<node>& pool(){
+		static library_checker::Pool<node> p;
+		return p;
+	}
+	using np=unsigned;
 	np root=0;
 	heap(np t=0):root(t){}
-	np meld(np a,np b){
-		if(!b)return a?new node(*a):0;
-		if(!a)return b?new node(*b):0;
-		a=new node(*a);b=new node(*b);
-		if(a->val>b->val)swap(a,b);
-		a->ch[1]=meld(a->ch[1],b);
-		if(!a->ch[0]||a->ch[0]->s<a->ch[1]->s)swap(a->ch[0],a->ch[1]);
-		a->s=(a->ch[1]?a->ch[1]->s:0)+1;
+	static np meld(np a,np b){
+		auto& p=pool();
+		if(!b)return a?p.make(p[a]):0;
+		if(!a)return b?p.make(p[b]):0;
+		a=p.make(p[a]);b=p.make(p[b]);
+		if(p[a].val>p[b].val)swap(a,b);
+		p[a].ch[1]=meld(p[a].ch[1],b);
+		if(!p[a].ch[0]||p[p[a].ch[0]].s<p[p[a].ch[1]].s)swap(p[a].ch[0],p[a].ch[1]);
+		p[a].s=(p[a].ch[1]?p[p[a].ch[1]].s:0)+1;
 		return a;
 	}
 	heap meld(heap b){
 		return heap(meld(root,b.root));
 	}
 	heap insert(T x,int from,int to){
-		return heap(meld(root,new node(x,from,to)));
+		return heap(meld(root,pool().make(x,from,to)));
 	}
 	heap pop(){
-		return heap(meld(root->ch[0],root->ch[1]));
+		return heap(meld(pool()[root].ch[0],pool()[root].ch[1]));
 	}
 	T top(){
-		return root?root->val:T(-1);
+		return root?pool()[root].val:T(-1);
 	}
 	bool empty(){
 		return !root;
@@ -113,14 +120,15 @@ int main(){
 		if(t>=INF)break;
 		ans.push_back(t);
 		if(int(ans.size())==k)break;
-		if(now->ch[0]){
-			qqq.emplace(t+now->ch[0]->val-now->val,now->ch[0]);
+		auto& pool=heap<lint>::pool();
+		if(pool[now].ch[0]){
+			qqq.emplace(t+pool[pool[now].ch[0]].val-pool[now].val,pool[now].ch[0]);
 		}
-		if(now->ch[1]){
-			qqq.emplace(t+now->ch[1]->val-now->val,now->ch[1]);
+		if(pool[now].ch[1]){
+			qqq.emplace(t+pool[pool[now].ch[1]].val-pool[now].val,pool[now].ch[1]);
 		}
-		if(h[now->to].root){
-			qqq.emplace(t+h[now->to].root->val,h[now->to].root);
+		if(h[pool[now].to].root){
+			qqq.emplace(t+pool[h[pool[now].to].root].val,h[pool[now].to].root);
 		}
 	}
 	for(lint i=0;i<k;++i){
@@ -1,10 +1,11 @@
 #include <vector>
 #include "random.h"
 #include "../params.h"
-#include "../fastio.h"
+#include "fastio.h"
 
 #define INDEX(i, j) ((i) * len + (j))
 int main(int, char **argv) {
+	library_checker::Printer pr(stdout);
 	long long seed = atoll(argv[1]);
 	auto gen = Random(seed);
 	
@@ -33,7 +34,7 @@ int main(int, char **argv) {
 	int t;
 	do t = gen.uniform(0, len * len - 1); while (s == t);
 	
-	println(len * len, ' ', (int) hens.size(), ' ', s, ' ', t);
-	for (auto i : hens) println(i.from, ' ', i.to, ' ', i.cost);
+	pr.writeln(len * len, ' ', (int) hens.size(), ' ', s, ' ', t);
+	for (auto i : hens) pr.writeln(i.from, ' ', i.to, ' ', i.cost);
 	return 0;
 }
@@ -1,7 +1,7 @@
 #include <vector>
 #include "random.h"
 #include "../params.h"
-#include "../fastio.h"
+#include "fastio.h"
 
 /*
 	a grid graph of len * len vertices
@@ -10,6 +10,7 @@
 
 #define INDEX(i, j) ((i) * len + (j))
 int main(int, char **argv) {
+	library_checker::Printer pr(stdout);
 	long long seed = atoll(argv[1]);
 	auto gen = Random(seed);
 	
@@ -39,7 +40,7 @@ int main(int, char **argv) {
 	}
 	gen.shuffle(hens.begin(), hens.end());
 	
-	println(len * len, ' ', (int) hens.size(), ' ', 0, ' ', INDEX(len / 2, len / 2 - 1));
-	for (auto i : hens) println(i.from, ' ', i.to, ' ', i.cost);
+	pr.writeln(len * len, ' ', (int) hens.size(), ' ', 0, ' ', INDEX(len / 2, len / 2 - 1));
+	for (auto i : hens) pr.writeln(i.from, ' ', i.to, ' ', i.cost);
 	return 0;
 }
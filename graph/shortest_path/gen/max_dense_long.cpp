@@ -2,9 +2,10 @@
 #include <numeric>
 #include "random.h"
 #include "../params.h"
-#include "../fastio.h"
+#include "fastio.h"
 
 int main(int, char **argv) {
+	library_checker::Printer pr(stdout);
 	long long seed = atoll(argv[1]);
 	auto gen = Random(seed);
 
@@ -17,7 +18,7 @@ int main(int, char **argv) {
 	gen.shuffle(path.begin(), path.end());
 	int s = path.front();
 	int t = path.back();
-	println(n, ' ', m, ' ', s, ' ', t);
+	pr.writeln(n, ' ', m, ' ', s, ' ', t);
 	
 	std::vector<int> next(n, -1);
 	for (int i = 0; i + 1 < (int) path.size(); i++) next[path[i]] = path[i + 1];
@@ -26,6 +27,6 @@ int main(int, char **argv) {
 	auto rnd_big = [&] () { return gen.uniform((int) C_MIN, (int) C_MAX); };
 	
 	for (int i = 0; i < n; i++) for (int j = 0; j < n; j++) if (i != j)
-		println(i, ' ', j, ' ', next[i] == j ? rnd_small() : rnd_big());
+		pr.writeln(i, ' ', j, ' ', next[i] == j ? rnd_small() : rnd_big());
 	return 0;
 }
@@ -1,8 +1,9 @@
 #include "random.h"
 #include "../params.h"
-#include "../fastio.h"
+#include "fastio.h"
 
 int main(int, char **argv) {
+	library_checker::Printer pr(stdout);
 	long long seed = atoll(argv[1]);
 	auto gen = Random(seed);
 
@@ -13,9 +14,9 @@ int main(int, char **argv) {
 	int s = gen.uniform(0, n - 1);
 	int t;
 	do t = gen.uniform(0, n - 1); while (s == t);
-	println(n, ' ', m, ' ', s, ' ', t);
+	pr.writeln(n, ' ', m, ' ', s, ' ', t);
 	
 	for (int i = 0; i < n; i++) for (int j = 0; j < n; j++) if (i != j)
-		println(i, ' ', j, ' ', 0);
+		pr.writeln(i, ' ', j, ' ', 0);
 	return 0;
 }
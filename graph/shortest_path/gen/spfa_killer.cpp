@@ -1,9 +1,10 @@
 #include <vector>
 #include "random.h"
 #include "../params.h"
-#include "../fastio.h"
+#include "fastio.h"
 
 int main(int, char **argv) {
+	library_checker::Printer pr(stdout);
 	long long seed = atoll(argv[1]);
 	auto gen = Random(seed);
 	
@@ -80,7 +81,7 @@ int main(int, char **argv) {
 	
 	gen.shuffle(hens.begin(), hens.end());
 	
-	println(n, ' ', m, ' ', s, ' ', t);
-	for (auto i : hens) println(i.from, ' ', i.to, ' ', i.cost);
+	pr.writeln(n, ' ', m, ' ', s, ' ', t);
+	for (auto i : hens) pr.writeln(i.from, ' ', i.to, ' ', i.cost);
 	return 0;
 }
@@ -1,44 +1,35 @@
-#include <vector>
-#include <queue>
+#include <cstring>
 #include <utility>
-#include <stdint.h>
-#include <algorithm>
-#include "../fastio.h"
+#include <vector>
+
+#include "dijkstra.h"
+#include "fastio.h"
 
-#define INF 1000000000000000000
+using namespace library_checker;
 
-template<typename T> using pqueue_inv = std::priority_queue<T, std::vector<T>, std::greater<T> >;
+// argv[1] = "radix" runs the radix heap, the indexed 4-ary heap otherwise.
+// The 4-ary heap breaks ties by the vertex, which keeps the reference output
+// independent of the heap implementation details.
+int main(int argc, char** argv) {
+    Scanner sc(stdin);
+    Printer pr(stdout);
+    int n, m, s, t;
+    sc.read(n, m, s, t);
+    std::vector<std::pair<int, int>> edges(m);
+    std::vector<long long> cost(m);
+    for (int i = 0; i < m; i++) {
+        sc.read(edges[i].first, edges[i].second, cost[i]);
+    }
+    Dijkstra dijkstra(CSRGraph::directed(n, edges), cost);
+    bool radix = argc > 1 && std::strcmp(argv[1], "radix") == 0;
+    dijkstra.run(s, radix ? Dijkstra::Heap::radix : Dijkstra::Heap::quaternary);
 
-int main() {
-	int n = ri();
-	int m = ri();
-	int s = ri();
-	int t = ri();
-	std::vector<std::vector<std::pair<int, int> > > hen(n);
-	for (int i = 0; i < m; i++) {
-		int a = ri();
-		int b = ri();
-		int c = ri();
-		hen[a].push_back({b, c});
-	}
-	std::vector<int64_t> dist(n, INF);
-	std::vector<int> from(n, -1);
-	pqueue_inv<std::pair<int64_t, int> > que;
-	que.push({dist[s] = 0, s});
-	while (que.size()) {
-		auto i = que.top();
-		que.pop();
-		if (i.first != dist[i.second]) continue;
-		for (auto j : hen[i.second]) if (dist[j.first] > i.first + j.second) 
-			que.push({dist[j.first] = i.first + j.second, j.first}), from[j.first] = i.second;
-	}
-	if (dist[t] == INF) println("-1");
-	else {
-		std::vector<int> path;
-		for (int cur = t; cur != -1; cur = from[cur]) path.push_back(cur);
-		std::reverse(path.begin(), path.end());
-		println(dist[t], ' ', path.size() - 1);
-		for (int i = 0; i + 1 < (int) path.size(); i++) println(path[i], ' ', path[i + 1]);
-	}
-	return 0;
+    if (dijkstra.dist[t] == Dijkstra::INF) {
+        pr.writeln(-1);
+        return 0;
+    }
+    auto path = dijkstra.path(t);
+    pr.writeln(dijkstra.dist[t], ' ', int(path.size()) - 1);
+    for (int i = 0; i + 1 < int(path.size()); i++) pr.writeln(path[i], ' ', path[i + 1]);
+    return 0;
 }
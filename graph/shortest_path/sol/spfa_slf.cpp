@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include <algorithm>
 
-#include "../fastio.h"
+#include "fastio.h"
 
 #define INF 1000000000000000000
 
@@ -12,10 +12,10 @@
 // O(NM)
 
 int main() {
-	int n = ri();
-	int m = ri();
-	int s = ri();
-	int t = ri();
+	library_checker::Scanner sc(stdin);
+	library_checker::Printer pr(stdout);
+	int n, m, s, t;
+	sc.read(n, m, s, t);
 	struct Hen {
 		int to;
 		int cost;
@@ -23,9 +23,8 @@ int main() {
 	};
 	std::vector<std::vector<std::pair<int, int> > > hen(n);
 	for (int i = 0; i < m; i++) {
-		int a = ri();
-		int b = ri();
-		int c = ri();
+		int a, b, c;
+		sc.read(a, b, c);
 		hen[a].push_back({b, c});
 	}
 	std::vector<int64_t> dist(n, INF);
@@ -49,13 +48,13 @@ int main() {
 			}
 		}
 	}
-	if (dist[t] == INF) println("-1");
+	if (dist[t] == INF) pr.writeln(-1);
 	else {
 		std::vector<int> path;
 		for (int cur = t; cur != -1; cur = from[cur]) path.push_back(cur);
 		std::reverse(path.begin(), path.end());
-		println(dist[t], ' ', path.size() - 1);
-		for (int i = 0; i + 1 < (int) path.size(); i++) println(path[i], ' ', path[i + 1]);
+		pr.writeln(dist[t], ' ', path.size() - 1);
+		for (int i = 0; i + 1 < (int) path.size(); i++) pr.writeln(path[i], ' ', path[i + 1]);
 	}
 	return 0;
 }
@@ -3,21 +3,20 @@
 #include <utility>
 #include <stdint.h>
 #include <algorithm>
-#include "../fastio.h"
+#include "fastio.h"
 
 template<typename T> using pqueue_inv = std::priority_queue<T, std::vector<T>, std::greater<T> >;
 
 int main() {
-	int n = ri();
-	int m = ri();
-	int s = ri();
-	int t = ri();
+	library_checker::Scanner sc(stdin);
+	library_checker::Printer pr(stdout);
+	int n, m, s, t;
+	sc.read(n, m, s, t);
 	std::vector<std::vector<std::pair<int, int> > > hen(n);
 	std::vector<std::vector<std::pair<int, int> > > rev(n);
 	for (int i = 0; i < m; i++) {
-		int a = ri();
-		int b = ri();
-		int c = ri();
+		int a, b, c;
+		sc.read(a, b, c);
 		hen[a].push_back({b, c});
 		rev[b].push_back({a, c});
 	}
@@ -33,7 +32,7 @@ int main() {
 				que.push({i.first + j.second, j.first});
 		}
 	}
-	if (dist[t] == -1) println("-1");
+	if (dist[t] == -1) pr.writeln(-1);
 	else {
 		std::vector<int> path;
 		std::vector<bool> used(n);
@@ -50,8 +49,8 @@ int main() {
 			}
 		}
 		std::reverse(path.begin(), path.end());
-		println(dist[t], ' ', path.size() - 1);
-		for (int i = 0; i + 1 < (int) path.size(); i++) println(path[i], ' ', path[i + 1]);
+		pr.writeln(dist[t], ' ', path.size() - 1);
+		for (int i = 0; i + 1 < (int) path.size(); i++) pr.writeln(path[i], ' ', path[i + 1]);
 	}
 	return 0;
 }
@@ -3,22 +3,21 @@
 #include <utility>
 #include <stdint.h>
 #include <algorithm>
-#include "../fastio.h"
+#include "fastio.h"
 
 #define INF 1000000000000000000
 
 template<typename T> using pqueue_inv = std::priority_queue<T, std::vector<T>, std::greater<T> >;
 
 int main() {
-	int n = ri();
-	int m = ri();
-	int s = ri();
-	int t = ri();
+	library_checker::Scanner sc(stdin);
+	library_checker::Printer pr(stdout);
+	int n, m, s, t;
+	sc.read(n, m, s, t);
 	std::vector<std::vector<std::pair<int, int> > > hen(n);
 	for (int i = 0; i < m; i++) {
-		int a = ri();
-		int b = ri();
-		int c = ri();
+		int a, b, c;
+		sc.read(a, b, c);
 		hen[a].push_back({b, c});
 	}
 	std::vector<bool> inqueue(n, false);
@@ -37,13 +36,13 @@ int main() {
 			if (!inqueue[j.first]) inqueue[j.first] = true, que.push({dist[j.first], j.first});
 		}
 	}
-	if (dist[t] == INF) println("-1");
+	if (dist[t] == INF) pr.writeln(-1);
 	else {
 		std::vector<int> path;
 		for (int cur = t; cur != -1; cur = from[cur]) path.push_back(cur);
 		std::reverse(path.begin(), path.end());
-		println(dist[t], ' ', path.size() - 1);
-		for (int i = 0; i + 1 < (int) path.size(); i++) println(path[i], ' ', path[i + 1]);
+		pr.writeln(dist[t], ' ', path.size() - 1);
+		for (int i = 0; i + 1 < (int) path.size(); i++) pr.writeln(path[i], ' ', path[i + 1]);
 	}
 	return 0;
 }
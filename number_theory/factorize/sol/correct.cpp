@@ -1,7 +1,8 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <map>
+
+#include "hash_map.h"
 
 using namespace std;
 using uint = unsigned int;
@@ -98,16 +99,16 @@ V<ll> pollard(ll n) {
 int main() {
     int q;
     scanf("%d", &q);
-    map<ll, V<ll>> cache;
+    library_checker::HashMap<ll, V<ll>> cache;
     for (int i = 0; i < q; i++) {
         ll a;
         scanf("%lld", &a);
-        if (!cache.count(a)) {
+        if (!cache.contains(a)) {
             auto v = pollard(a);
             sort(v.begin(), v.end());
             cache[a] = v;
         }
-        auto v = cache[a];
+        const auto &v = *cache.find(a);
         printf("%d", int(v.size()));
         for (auto d: v) printf(" %lld", d);
         printf("\n");
@@ -4,6 +4,8 @@
 #include <cstdio>
 #include <vector>
 
+#include "ntt.h"
+
 using namespace std;
 using uint = unsigned int;
 using ll = long long;
@@ -14,7 +16,6 @@ template <class T> using VV = V<V<T>>;
 
 template <uint MD> struct ModInt {
     using M = ModInt;
-    const static M G;
     uint v;
     ModInt(ll _v = 0) { set_v(_v % MD + MD); }
     M& set_v(uint _v) {
@@ -45,59 +46,6 @@ template <uint MD> struct ModInt {
     friend ostream& operator<<(ostream& os, const M& r) { return os << r.v; }
 };
 using Mint = ModInt<998244353>;
-template <> const Mint Mint::G = Mint(3);
-
-template <class Mint> void nft(bool type, V<Mint>& a) {
-    int n = int(a.size()), s = 0;
-    while ((1 << s) < n) s++;
-    assert(1 << s == n);
-
-    static V<Mint> ep, iep;
-    while (int(ep.size()) <= s) {
-        ep.push_back(Mint::G.pow(Mint(-1).v / (1 << ep.size())));
-        iep.push_back(ep.back().inv());
-    }
-    V<Mint> b(n);
-    for (int i = 1; i <= s; i++) {
-        int w = 1 << (s - i);
-        Mint base = type ? iep[i] : ep[i], now = 1;
-        for (int y = 0; y < n / 2; y += w) {
-            for (int x = 0; x < w; x++) {
-                auto l = a[y << 1 | x];
-                auto r = now * a[y << 1 | x | w];
-                b[y | x] = l + r;
-                b[y | x | n >> 1] = l - r;
-            }
-            now *= base;
-        }
-        swap(a, b);
-    }
-}
-
-template <class Mint> V<Mint> multiply(const V<Mint>& a, const V<Mint>& b) {
-    int n = int(a.size()), m = int(b.size());
-    if (!n || !m) return {};
-    if (min(n, m) <= 8) {
-        V<Mint> ans(n + m - 1);
-        for (int i = 0; i < n; i++)
-            for (int j = 0; j < m; j++) ans[i + j] += a[i] * b[j];
-        return ans;
-    }
-    int lg = 0;
-    while ((1 << lg) < n + m - 1) lg++;
-    int z = 1 << lg;
-    auto a2 = a, b2 = b;
-    a2.resize(z);
-    b2.resize(z);
-    nft(false, a2);
-    nft(false, b2);
-    for (int i = 0; i < z; i++) a2[i] *= b2[i];
-    nft(true, a2);
-    a2.resize(n + m - 1);
-    Mint iz = Mint(z).inv();
-    for (int i = 0; i < n + m - 1; i++) a2[i] *= iz;
-    return a2;
-}
 
 template <class D> struct Poly {
     V<D> v;
@@ -121,7 +69,7 @@ template <class D> struct Poly {
         for (int i = 0; i < n; i++) res[i] = freq(i) - r.freq(i);
         return res;
     }
-    Poly operator*(const Poly& r) const { return {multiply(v, r.v)}; }
+    Poly operator*(const Poly& r) const { return {library_checker::multiply<998244353>(v, r.v)}; }
     Poly operator*(const D& r) const {
         int n = size();
         V<D> res(n);
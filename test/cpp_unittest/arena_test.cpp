@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <vector>
+
+#include "arena.h"
+#include "gtest/gtest.h"
+
+using namespace library_checker;
+
+struct Node {
+    std::uint32_t next;
+    long long value;
+};
+
+using SmallPool = Pool<Node, 3>;
+
+TEST(ArenaTest, IndicesAndReferencesAreStable) {
+    SmallPool pool;
+    std::vector<Node*> ptrs;
+    std::uint32_t head = SmallPool::null;
+    for (int i = 0; i < 100; i++) {
+        auto id = pool.make(head, (long long)i);
+        ASSERT_NE(SmallPool::null, id);
+        ASSERT_EQ(std::uint32_t(i + 1), id);
+        ptrs.push_back(&pool[id]);
+        head = id;
+    }
+    ASSERT_EQ(101u, pool.size());
+    ASSERT_EQ(13u * 8 * sizeof(Node), pool.capacity_bytes());
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(ptrs[i], &pool[std::uint32_t(i + 1)]);
+        ASSERT_EQ(i, pool[std::uint32_t(i + 1)].value);
+    }
+    long long sum = 0;
+    for (auto id = head; id != SmallPool::null; id = pool[id].next) {
+        sum += pool[id].value;
+    }
+    ASSERT_EQ(99 * 100 / 2, sum);
+}
+
+struct Leaf {
+    Leaf(int a_, int b_) : a(a_), b(b_) {}
+    int a, b;
+};
+
+TEST(ArenaTest, Constructor) {
+    Pool<Leaf> pool;
+    auto x = pool.make(1, 2);
+    auto y = pool.make(pool[x]);
+    ASSERT_EQ(1, pool[y].a);
+    ASSERT_EQ(2, pool[y].b);
+}
+
+struct Link {
+    Link* next;
+    int value;
+};
+
+TEST(ArenaTest, HugePagesAndClear) {
+    Pool<Link> pool(true);
+    Link* head = nullptr;
+    for (int i = 0; i < 200000; i++) head = pool.make_ptr(Link{head, i});
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(&pool[1] - 1) % Pool<Link>::HUGE_PAGE);
+    long long sum = 0;
+    for (Link* p = head; p; p = p->next) sum += p->value;
+    ASSERT_EQ(199999LL * 200000 / 2, sum);
+
+    // 2^16 Links are 1 MiB, each chunk still covers a whole huge page
+    auto bytes = pool.capacity_bytes();
+    ASSERT_EQ(0u, bytes % Pool<Link>::HUGE_PAGE);
+    pool.clear();
+    ASSERT_EQ(1u, pool.size());
+    pool.make(nullptr, 1);
+    ASSERT_EQ(bytes, pool.capacity_bytes());
+}
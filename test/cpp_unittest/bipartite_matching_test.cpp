@@ -0,0 +1,111 @@
+#include <utility>
+#include <vector>
+
+#include "bipartite_matching.h"
+#include "gtest/gtest.h"
+#include "random.h"
+
+using namespace library_checker;
+
+namespace {
+
+// Kuhn's algorithm, O(nm)
+int naive(int l, int r, const std::vector<std::pair<int, int>>& edges) {
+    std::vector<std::vector<int>> adj(l);
+    for (auto [a, b] : edges) adj[a].push_back(b);
+    std::vector<int> match_r(r, -1);
+    std::vector<char> used;
+    auto dfs = [&](auto self, int u) -> bool {
+        for (int v : adj[u]) {
+            if (used[v]) continue;
+            used[v] = true;
+            if (match_r[v] == -1 || self(self, match_r[v])) {
+                match_r[v] = u;
+                return true;
+            }
+        }
+        return false;
+    };
+    int res = 0;
+    for (int u = 0; u < l; u++) {
+        used.assign(r, false);
+        if (dfs(dfs, u)) res++;
+    }
+    return res;
+}
+
+void check(int l, int r, const std::vector<std::pair<int, int>>& edges, int expected) {
+    BipartiteMatching bm(l, r, edges);
+    ASSERT_EQ(expected, bm.size());
+    int cnt = 0;
+    for (int u = 0; u < l; u++) {
+        if (bm.match_l[u] == -1) {
+            ASSERT_EQ(-1, bm.match_edge[u]);
+            continue;
+        }
+        cnt++;
+        ASSERT_EQ(u, bm.match_r[bm.match_l[u]]);
+        ASSERT_EQ(std::make_pair(u, bm.match_l[u]), edges[bm.match_edge[u]]);
+    }
+    ASSERT_EQ(expected, cnt);
+    for (int v = 0; v < r; v++) {
+        if (bm.match_r[v] != -1) {
+            ASSERT_EQ(v, bm.match_l[bm.match_r[v]]);
+        }
+    }
+    auto pairs = bm.pairs();
+    ASSERT_EQ(expected, int(pairs.size()));
+    for (int i = 0; i + 1 < int(pairs.size()); i++) ASSERT_LT(pairs[i].first, pairs[i + 1].first);
+}
+
+}  // namespace
+
+TEST(BipartiteMatchingTest, Random) {
+    Random gen(1);
+    for (int iter = 0; iter < 2000; iter++) {
+        int l = gen.uniform(0, 20), r = gen.uniform(0, 20);
+        int m = (l == 0 || r == 0) ? 0 : gen.uniform(0, 60);
+        std::vector<std::pair<int, int>> edges(m);
+        for (auto& [a, b] : edges) {
+            a = gen.uniform(0, l - 1);
+            b = gen.uniform(0, r - 1);
+        }
+        check(l, r, edges, naive(l, r, edges));
+    }
+}
+
+TEST(BipartiteMatchingTest, Large) {
+    Random gen(1);
+    for (int n : {1000, 3000}) {
+        for (int deg : {1, 2, 3, 10}) {
+            std::vector<std::pair<int, int>> edges;
+            for (int i = 0; i < n * deg; i++) {
+                edges.emplace_back(gen.uniform(0, n - 1), gen.uniform(0, n - 1));
+            }
+            check(n, n, edges, naive(n, n, edges));
+        }
+    }
+}
+
+TEST(BipartiteMatchingTest, Structured) {
+    // a path l0 - r0 - l1 - r1 - ...: the greedy start that takes l_i - r_i
+    // for odd i first needs long augmenting paths
+    for (int n : {1, 2, 100, 10000}) {
+        std::vector<std::pair<int, int>> edges;
+        for (int i = 0; i < n; i++) {
+            if (i) edges.emplace_back(i, i - 1);
+            edges.emplace_back(i, i);
+        }
+        check(n, n, edges, n);
+    }
+    // complete bipartite with multiple edges, unbalanced
+    std::vector<std::pair<int, int>> edges;
+    for (int a = 0; a < 30; a++) {
+        for (int b = 0; b < 7; b++) {
+            edges.emplace_back(a, b);
+            edges.emplace_back(a, b);
+        }
+    }
+    check(30, 7, edges, 7);
+    check(3, 5, {}, 0);
+}
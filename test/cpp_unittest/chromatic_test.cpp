@@ -0,0 +1,138 @@
+#include <cstdint>
+#include <vector>
+
+#include "chromatic.h"
+#include "gtest/gtest.h"
+#include "random.h"
+
+using namespace library_checker;
+
+namespace {
+
+std::vector<std::uint32_t> random_graph(Random& gen, int n, double p) {
+    std::vector<std::uint32_t> adj(n);
+    for (int u = 0; u < n; u++) {
+        for (int v = u + 1; v < n; v++) {
+            if (gen.uniform01() < p) {
+                adj[u] |= 1u << v;
+                adj[v] |= 1u << u;
+            }
+        }
+    }
+    return adj;
+}
+
+bool independent(const std::vector<std::uint32_t>& adj, std::uint32_t s) {
+    for (int v = 0; v < int(adj.size()); v++) {
+        if ((s >> v & 1) && (adj[v] & s)) return false;
+    }
+    return true;
+}
+
+// tries every coloring with k colors, vertex by vertex
+int naive(const std::vector<std::uint32_t>& adj) {
+    int n = int(adj.size());
+    std::vector<int> color(n, -1);
+    for (int k = 0;; k++) {
+        auto dfs = [&](auto self, int v) -> bool {
+            if (v == n) return true;
+            for (int c = 0; c < k; c++) {
+                bool ok = true;
+                for (int u = 0; u < v; u++) {
+                    if ((adj[v] >> u & 1) && color[u] == c) ok = false;
+                }
+                if (!ok) continue;
+                color[v] = c;
+                if (self(self, v + 1)) return true;
+            }
+            return false;
+        };
+        if (dfs(dfs, 0)) return k;
+    }
+}
+
+}  // namespace
+
+TEST(ChromaticTest, IndependentSetCounts) {
+    Random gen(1);
+    for (int iter = 0; iter < 100; iter++) {
+        int n = gen.uniform(0, 10);
+        auto adj = random_graph(gen, n, gen.uniform01());
+        auto cnt = independent_set_counts(n, adj);
+        for (std::uint32_t s = 0; s < (1u << n); s++) {
+            std::uint32_t expected = 0;
+            for (std::uint32_t t = s;; t = (t - 1) & s) {
+                expected += independent(adj, t);
+                if (t == 0) break;
+            }
+            ASSERT_EQ(expected, cnt[s]);
+        }
+    }
+}
+
+TEST(ChromaticTest, CoverCounts) {
+    // the tuples are built one set at a time, by their union
+    Random gen(1);
+    for (int iter = 0; iter < 100; iter++) {
+        int n = gen.uniform(0, 5);
+        auto adj = random_graph(gen, n, gen.uniform01());
+        std::vector<std::uint32_t> indep;
+        for (std::uint32_t s = 0; s < (1u << n); s++) {
+            if (independent(adj, s)) indep.push_back(s);
+        }
+        std::uint32_t full = (1u << n) - 1;
+        // covers[u] = the number of tuples so far whose union is u
+        std::vector<std::uint64_t> covers(1u << n, 0);
+        covers[0] = 1;
+        IndependentCoverCounter counter(n, adj, 998244353);
+        for (int k = 0; k <= 3; k++) {
+            ASSERT_EQ(covers[full] % 998244353, counter.next());
+            std::vector<std::uint64_t> nxt(1u << n, 0);
+            for (std::uint32_t u = 0; u <= full; u++) {
+                for (auto s : indep) nxt[u | s] += covers[u];
+            }
+            covers = nxt;
+        }
+    }
+}
+
+TEST(ChromaticTest, Random) {
+    Random gen(1);
+    for (int iter = 0; iter < 300; iter++) {
+        int n = gen.uniform(0, 10);
+        auto adj = random_graph(gen, n, gen.uniform01());
+        ASSERT_EQ(naive(adj), chromatic_number(n, adj));
+    }
+}
+
+TEST(ChromaticTest, Structured) {
+    // complete graphs, odd and even cycles, empty graph
+    for (int n = 1; n <= 20; n++) {
+        std::vector<std::uint32_t> complete(n), cycle(n), empty(n);
+        for (int v = 0; v < n; v++) {
+            complete[v] = ((1u << n) - 1) & ~(1u << v);
+            if (n >= 3) cycle[v] = 1u << ((v + 1) % n) | 1u << ((v + n - 1) % n);
+        }
+        ASSERT_EQ(n, chromatic_number(n, complete));
+        ASSERT_EQ(n < 3 ? 1 : n % 2 ? 3 : 2, chromatic_number(n, cycle));
+        ASSERT_EQ(1, chromatic_number(n, empty));
+    }
+    ASSERT_EQ(0, chromatic_number(0, {}));
+}
+
+TEST(ChromaticTest, ScalarMatchesVector) {
+    Random gen(1);
+    for (int iter = 0; iter < 20; iter++) {
+        int n = gen.uniform(10, 18);
+        auto adj = random_graph(gen, n, gen.uniform01());
+        std::vector<std::uint32_t> expected, actual;
+        {
+            DisableCpuFeature no_avx2(CpuFeature::avx2);
+            IndependentCoverCounter scalar(n, adj, 1000000007);
+            for (int k = 0; k <= n; k++) expected.push_back(scalar.next());
+        }
+        IndependentCoverCounter vector(n, adj, 1000000007);
+        for (int k = 0; k <= n; k++) actual.push_back(vector.next());
+        ASSERT_EQ(expected, actual);
+    }
+}
@@ -0,0 +1,23 @@
+#include "cpu_features.h"
+#include "gtest/gtest.h"
+
+using namespace library_checker;
+
+TEST(CpuFeaturesTest, Disable) {
+    bool avx2 = cpu_supports(CpuFeature::avx2);
+    bool popcnt = cpu_supports(CpuFeature::popcnt);
+    {
+        DisableCpuFeature no_avx2(CpuFeature::avx2);
+        ASSERT_FALSE(cpu_supports(CpuFeature::avx2));
+        ASSERT_EQ(popcnt, cpu_supports(CpuFeature::popcnt));
+        {
+            DisableCpuFeature no_popcnt(CpuFeature::popcnt);
+            ASSERT_FALSE(cpu_supports(CpuFeature::avx2));
+            ASSERT_FALSE(cpu_supports(CpuFeature::popcnt));
+        }
+        ASSERT_FALSE(cpu_supports(CpuFeature::avx2));
+        ASSERT_EQ(popcnt, cpu_supports(CpuFeature::popcnt));
+    }
+    ASSERT_EQ(avx2, cpu_supports(CpuFeature::avx2));
+    ASSERT_EQ(popcnt, cpu_supports(CpuFeature::popcnt));
+}
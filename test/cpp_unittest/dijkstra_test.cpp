@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "dijkstra.h"
+#include "gtest/gtest.h"
+#include "random.h"
+
+using namespace library_checker;
+
+namespace {
+
+struct Instance {
+    int n;
+    std::vector<std::pair<int, int>> edges;
+    std::vector<long long> cost;
+};
+
+Instance random_instance(Random& gen, int n, int m, long long max_cost) {
+    Instance g{n, {}, {}};
+    for (int i = 0; i < m; i++) {
+        g.edges.emplace_back(gen.uniform(0, n - 1), gen.uniform(0, n - 1));
+        g.cost.push_back(gen.uniform(0LL, max_cost));
+    }
+    return g;
+}
+
+// priority_queue of (distance, vertex) with lazy deletion
+std::pair<std::vector<long long>, std::vector<int>> naive(const Instance& g, int s) {
+    std::vector<std::vector<std::pair<int, long long>>> adj(g.n);
+    for (int i = 0; i < int(g.edges.size()); i++) {
+        adj[g.edges[i].first].emplace_back(g.edges[i].second, g.cost[i]);
+    }
+    std::vector<long long> dist(g.n, Dijkstra::INF);
+    std::vector<int> par(g.n, -1);
+    std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>,
+                        std::greater<>>
+        que;
+    que.push({dist[s] = 0, s});
+    while (!que.empty()) {
+        auto [d, v] = que.top();
+        que.pop();
+        if (d != dist[v]) continue;
+        for (auto [to, c] : adj[v]) {
+            if (d + c < dist[to]) {
+                que.push({dist[to] = d + c, to});
+                par[to] = v;
+            }
+        }
+    }
+    return {dist, par};
+}
+
+}  // namespace
+
+TEST(RadixHeapTest, Random) {
+    Random gen(1);
+    for (std::uint64_t max_step : {0ULL, 1ULL, 100ULL, 1ULL << 40, 1ULL << 50}) {
+        RadixHeap<int> heap;
+        std::multiset<std::pair<std::uint64_t, int>> ref;
+        std::uint64_t last = 0;
+        for (int i = 0; i < 10000; i++) {
+            if (ref.empty() || gen.uniform(0, 2)) {
+                std::uint64_t key = last + gen.uniform<std::uint64_t>(0, max_step);
+                heap.push(key, i);
+                ref.insert({key, i});
+            } else {
+                auto [key, val] = heap.pop();
+                ASSERT_EQ(ref.begin()->first, key);
+                ASSERT_TRUE(ref.count({key, val}));
+                ref.erase(ref.find({key, val}));
+                last = key;
+            }
+            ASSERT_EQ(ref.size(), heap.size());
+        }
+    }
+}
+
+TEST(IndexedQuaternaryHeapTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 5, 100}) {
+        IndexedQuaternaryHeap<long long> heap(n);
+        std::vector<long long> key(n);
+        std::set<std::pair<long long, int>> ref;
+        for (int i = 0; i < 10000; i++) {
+            if (ref.empty() || gen.uniform(0, 2)) {
+                int id = gen.uniform(0, n - 1);
+                long long k = gen.uniform(0, 50);
+                heap.push_or_decrease(id, k);
+                if (!ref.count({key[id], id})) {
+                    ref.insert({key[id] = k, id});
+                } else if (k < key[id]) {
+                    ref.erase({key[id], id});
+                    ref.insert({key[id] = k, id});
+                }
+            } else {
+                ASSERT_EQ(*ref.begin(), heap.pop());
+                ref.erase(ref.begin());
+            }
+            ASSERT_EQ(int(ref.size()), heap.size());
+            int id = gen.uniform(0, n - 1);
+            ASSERT_EQ(ref.count({key[id], id}) == 1, heap.contains(id));
+        }
+    }
+}
+
+TEST(DijkstraTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 10, 100, 1000}) {
+        for (long long max_cost : {0LL, 1LL, 10LL, 1000000000LL}) {
+            for (int m : {0, n, 5 * n}) {
+                auto g = random_instance(gen, n, m, max_cost);
+                Dijkstra dijkstra(CSRGraph::directed(n, g.edges), g.cost);
+                for (int iter = 0; iter < 3; iter++) {
+                    int s = gen.uniform(0, n - 1);
+                    auto [dist, par] = naive(g, s);
+                    for (auto heap : {Dijkstra::Heap::radix, Dijkstra::Heap::quaternary}) {
+                        dijkstra.run(s, heap);
+                        ASSERT_EQ(dist, dijkstra.dist);
+                        if (heap == Dijkstra::Heap::quaternary) {
+                            ASSERT_EQ(par, dijkstra.par);
+                        }
+                        for (int v = 0; v < n; v++) {
+                            int e = dijkstra.par_edge[v];
+                            if (e == -1) {
+                                ASSERT_TRUE(v == s || dist[v] == Dijkstra::INF);
+                                continue;
+                            }
+                            ASSERT_EQ(g.edges[e], std::make_pair(dijkstra.par[v], v));
+                            ASSERT_EQ(dist[dijkstra.par[v]] + g.cost[e], dist[v]);
+                        }
+                        int t = gen.uniform(0, n - 1);
+                        auto path = dijkstra.path(t);
+                        if (dist[t] == Dijkstra::INF) {
+                            ASSERT_TRUE(path.empty());
+                        } else {
+                            ASSERT_EQ(s, path.front());
+                            ASSERT_EQ(t, path.back());
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(DijkstraTest, LongLine) {
+    int n = 1 << 16;
+    std::vector<std::pair<int, int>> edges;
+    std::vector<long long> cost;
+    for (int i = 0; i + 1 < n; i++) {
+        edges.emplace_back(i, i + 1);
+        cost.push_back(1000000000);
+    }
+    Dijkstra dijkstra(CSRGraph::directed(n, edges), cost);
+    for (auto heap : {Dijkstra::Heap::radix, Dijkstra::Heap::quaternary}) {
+        dijkstra.run(0, heap);
+        ASSERT_EQ(1000000000LL * (n - 1), dijkstra.dist[n - 1]);
+        ASSERT_EQ(n, int(dijkstra.path(n - 1).size()));
+    }
+}
@@ -93,6 +93,124 @@ TEST(FastIOTest, ScannerPreSpace) {
     ASSERT_EQ(1234, x);
 }
 
+TEST(FastIOTest, ScannerDigitLength) {
+    auto tmpf = tmpfile();
+    std::vector<unsigned long long> v;
+    unsigned long long x = 0;
+    for (int i = 1; i <= 20; i++) {
+        x = 10 * x + (unsigned long long)(i % 10);
+        v.push_back(x);
+        v.push_back(x - 1);
+    }
+    for (auto y : v) {
+        fputs((std::to_string(y) + " ").c_str(), tmpf);
+    }
+    rewind(tmpf);
+
+    Scanner sc(tmpf);
+    unsigned long long y;
+    for (auto z : v) {
+        sc.read(y);
+        ASSERT_EQ(z, y);
+    }
+}
+
+TEST(FastIOTest, ScannerManyBlanks) {
+    auto tmpf = tmpfile();
+    std::vector<int> v;
+    std::string s;
+    for (int i = 0; i < 1000; i++) {
+        v.push_back(i * 12345);
+        s += std::to_string(i * 12345);
+        for (int j = 0; j <= i % 70; j++) {
+            s += " \n\t\r"[j % 4];
+        }
+    }
+    fputs(s.c_str(), tmpf);
+    rewind(tmpf);
+
+    Scanner sc(tmpf);
+    int y;
+    for (auto x : v) {
+        sc.read(y);
+        ASSERT_EQ(x, y);
+    }
+}
+
+TEST(FastIOTest, ScannerReadArray) {
+    auto tmpf = tmpfile();
+    std::vector<long long> v;
+    for (int i = 0; i < 100000; i++) {
+        v.push_back((long long)i * i * (i % 2 ? -1 : 1));
+    }
+    for (auto x : v) {
+        fputs((std::to_string(x) + " ").c_str(), tmpf);
+    }
+    rewind(tmpf);
+
+    Scanner sc(tmpf);
+    std::vector<long long> w(v.size());
+    sc.read_array(w.data(), w.size());
+    ASSERT_EQ(v, w);
+}
+
+TEST(FastIOTest, ScannerPipe) {
+    auto fp = popen("seq 1 200000", "r");
+    Scanner sc(fp);
+    int y;
+    for (int x = 1; x <= 200000; x++) {
+        sc.read(y);
+        ASSERT_EQ(x, y);
+    }
+    pclose(fp);
+}
+
+TEST(FastIOTest, ScannerOffset) {
+    auto tmpf = tmpfile();
+    std::vector<int> v;
+    std::vector<long> pos;
+    for (int i = 0; i < 10000; i++) {
+        v.push_back(i * 7);
+        pos.push_back(ftell(tmpf));
+        fputs((std::to_string(i * 7) + "\n").c_str(), tmpf);
+    }
+    fflush(tmpf);
+
+    // start from the middle of a page
+    for (int start : {0, 1, 1000, 5000, 9999}) {
+        lseek(fileno(tmpf), pos[start], SEEK_SET);
+        Scanner sc(tmpf);
+        int y;
+        for (int i = start; i < 10000; i++) {
+            sc.read(y);
+            ASSERT_EQ(v[i], y);
+        }
+    }
+}
+
+TEST(FastIOTest, ScannerPageBoundary) {
+    // the last token ends at EOF, without a newline
+    for (int size : {4095, 4096, 4097, 8192}) {
+        auto tmpf = tmpfile();
+        std::string s;
+        while (int(s.size()) + 10 < size) s += "123456789 ";
+        s += std::string(size - s.size(), '9');
+        fputs(s.c_str(), tmpf);
+        rewind(tmpf);
+
+        Scanner sc(tmpf);
+        int y;
+        while (int(s.size()) > 10) {
+            sc.read(y);
+            ASSERT_EQ(123456789, y);
+            s = s.substr(10);
+        }
+        unsigned long long z;
+        sc.read(z);
+        ASSERT_EQ(std::stoull(s), z);
+    }
+}
+
 TEST(FastIOTest, PrinterInt) {
     auto tmpf = tmpfile();
     std::vector<int> v;
@@ -239,3 +357,58 @@ TEST(FastIOTest, ScannerPrinterInt128) {
         ASSERT_EQ(x, y);
     }
 }
+
+std::string to_string_u128(unsigned __int128 x) {
+    std::string s;
+    do {
+        s += char('0' + int(x % 10));
+        x /= 10;
+    } while (x);
+    return std::string(s.rbegin(), s.rend());
+}
+
+TEST(FastIOTest, PrinterUnsignedInt128) {
+    std::vector<unsigned __int128> v;
+    unsigned __int128 x = 1;
+    for (int i = 0; i <= 38; i++) {
+        for (int j = -10; j < 10; j++) {
+            v.push_back(x + j);
+        }
+        x *= 10;
+    }
+    for (int i = 0; i < 1000; i++) {
+        v.push_back(~(unsigned __int128)(0) - i);
+    }
+
+    auto tmpf = tmpfile();
+    Printer pr(tmpf);
+    for (auto y : v) {
+        pr.writeln(y);
+    }
+    pr.flush();
+
+    rewind(tmpf);
+    char buf[100];
+    for (auto y : v) {
+        fgets(buf, 100, tmpf);
+        ASSERT_EQ(to_string_u128(y) + "\n", std::string(buf));
+    }
+}
+
+TEST(FastIOTest, PrinterWriteArray) {
+    auto tmpf = tmpfile();
+    Printer pr(tmpf);
+    pr.write_array(std::vector<int>{1, -23, 456});
+    pr.writeln();
+    pr.write_array(std::vector<long long>{});
+    pr.writeln();
+    pr.write_array(std::vector<unsigned int>{7, 8}, '\n');
+    pr.writeln();
+    pr.flush();
+
+    rewind(tmpf);
+    std::string s;
+    char buf[100];
+    while (fgets(buf, 100, tmpf)) s += buf;
+    ASSERT_EQ("1 -23 456\n\n7\n8\n", s);
+}
@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "gtest/gtest.h"
+#include "random.h"
+#include "unionfind.h"
+
+using namespace library_checker;
+
+namespace {
+
+using Edges = std::vector<std::pair<int, int>>;
+
+Edges random_graph(Random& gen, int n, int m, bool self_loops) {
+    Edges edges;
+    while (int(edges.size()) < m) {
+        int u = gen.uniform(0, n - 1), v = gen.uniform(0, n - 1);
+        if (u == v && !self_loops) continue;
+        edges.emplace_back(u, v);
+    }
+    return edges;
+}
+
+// connected components of the undirected graph without the edges in removed
+UnionFind components(int n, const Edges& edges, const std::vector<int>& removed) {
+    UnionFind uf(n);
+    for (int i = 0; i < int(edges.size()); i++) {
+        if (std::find(removed.begin(), removed.end(), i) == removed.end()) {
+            uf.merge(edges[i].first, edges[i].second);
+        }
+    }
+    return uf;
+}
+
+// sorted groups of sorted vertices
+std::vector<std::vector<int>> normalize(std::vector<std::vector<int>> groups) {
+    for (auto& g : groups) std::sort(g.begin(), g.end());
+    std::sort(groups.begin(), groups.end());
+    return groups;
+}
+
+// groups of the equivalence relation same(u, v)
+template <class F> std::vector<std::vector<int>> classes(int n, F same) {
+    std::vector<std::vector<int>> res;
+    std::vector<char> done(n, false);
+    for (int v = 0; v < n; v++) {
+        if (done[v]) continue;
+        res.emplace_back();
+        for (int u = v; u < n; u++) {
+            if (!done[u] && same(v, u)) {
+                done[u] = true;
+                res.back().push_back(u);
+            }
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST(GraphTest, CSROrder) {
+    Edges edges = {{0, 1}, {2, 0}, {0, 2}, {1, 1}, {0, 1}};
+    CSRGraph g = CSRGraph::undirected(3, edges);
+    ASSERT_EQ(10, g.num_arcs());
+    std::vector<std::pair<int, int>> arcs0;
+    for (auto a : g[0]) arcs0.emplace_back(a.to, a.id);
+    ASSERT_EQ((std::vector<std::pair<int, int>>{{1, 0}, {2, 1}, {2, 2}, {1, 4}}), arcs0);
+    ASSERT_EQ(4, g[1].size());
+    CSRGraph d = CSRGraph::directed(3, edges);
+    ASSERT_EQ(5, d.num_arcs());
+    ASSERT_EQ(3, d[0].size());
+    ASSERT_EQ(1, d[2].size());
+}
+
+TEST(GraphTest, SCC) {
+    Random gen(1);
+    for (int i = 0; i < 200; i++) {
+        int n = gen.uniform(1, 12), m = gen.uniform(0, 20);
+        Edges edges = random_graph(gen, n, m, true);
+        // reach[u][v]
+        std::vector<std::vector<char>> reach(n, std::vector<char>(n, false));
+        for (int v = 0; v < n; v++) reach[v][v] = true;
+        for (auto [u, v] : edges) reach[u][v] = true;
+        for (int k = 0; k < n; k++) {
+            for (int u = 0; u < n; u++) {
+                for (int v = 0; v < n; v++) {
+                    if (reach[u][k] && reach[k][v]) reach[u][v] = true;
+                }
+            }
+        }
+        auto groups = strongly_connected_components(CSRGraph::directed(n, edges));
+        auto expect = classes(n, [&](int u, int v) { return reach[u][v] && reach[v][u]; });
+        ASSERT_EQ(normalize(expect), normalize(groups));
+        // topological order
+        std::vector<int> id(n);
+        for (int c = 0; c < int(groups.size()); c++) {
+            for (int v : groups[c]) id[v] = c;
+        }
+        for (auto [u, v] : edges) ASSERT_LE(id[u], id[v]);
+    }
+}
+
+TEST(GraphTest, LowLink) {
+    Random gen(2);
+    for (int i = 0; i < 300; i++) {
+        int n = gen.uniform(1, 10), m = n == 1 ? 0 : gen.uniform(0, 14);
+        Edges edges = random_graph(gen, n, m, false);
+        CSRGraph g = CSRGraph::undirected(n, edges);
+        LowLink ll(g);
+        UnionFind all = components(n, edges, {});
+
+        std::vector<int> bridges;
+        for (int e = 0; e < m; e++) {
+            UnionFind uf = components(n, edges, {e});
+            if (!uf.same(edges[e].first, edges[e].second)) bridges.push_back(e);
+        }
+        ASSERT_EQ(bridges, ll.bridges());
+
+        std::vector<int> cuts;
+        for (int v = 0; v < n; v++) {
+            // v is a cut vertex if removing it separates two of its neighbors
+            UnionFind uf(n);
+            for (auto [a, b] : edges) {
+                if (a != v && b != v) uf.merge(a, b);
+            }
+            bool cut = false;
+            for (auto [a, b] : edges) {
+                for (auto [c, d] : edges) {
+                    int x = a == v ? b : (b == v ? a : -1);
+                    int y = c == v ? d : (d == v ? c : -1);
+                    if (x != -1 && y != -1 && !uf.same(x, y)) cut = true;
+                }
+            }
+            if (cut) cuts.push_back(v);
+        }
+        ASSERT_EQ(cuts, ll.articulation_points());
+
+        auto two = ll.two_edge_connected_components();
+        auto expect_two = classes(n, [&](int u, int v) {
+            if (!all.same(u, v)) return false;
+            for (int e : bridges) {
+                if (!components(n, edges, {e}).same(u, v)) return false;
+            }
+            return true;
+        });
+        ASSERT_EQ(normalize(expect_two), normalize(two));
+        // by the smallest vertex, which comes first
+        for (int c = 0; c < int(two.size()); c++) {
+            ASSERT_EQ(*std::min_element(two[c].begin(), two[c].end()), two[c][0]);
+            if (c) {
+                ASSERT_LT(two[c - 1][0], two[c][0]);
+            }
+        }
+
+        // biconnected: edges e, f are in one block iff e == f or they lie on
+        // a common cycle; compare the vertex sets of the blocks
+        std::vector<std::vector<int>> blocks;
+        {
+            UnionFind block(m);
+            for (int e = 0; e < m; e++) {
+                for (int f = e + 1; f < m; f++) {
+                    // on a common cycle iff they share a vertex and removing
+                    // that vertex keeps the other ends connected, or via the
+                    // transitive closure of that
+                    auto [a, b] = edges[e];
+                    auto [c, d] = edges[f];
+                    for (int v : {a, b}) {
+                        if (v != c && v != d) continue;
+                        int x = a == v ? b : a, y = c == v ? d : c;
+                        UnionFind uf(n);
+                        for (int k = 0; k < m; k++) {
+                            if (k == e || k == f) continue;
+                            if (edges[k].first != v && edges[k].second != v) {
+                                uf.merge(edges[k].first, edges[k].second);
+                            }
+                        }
+                        if (x == y || uf.same(x, y)) block.merge(e, f);
+                    }
+                }
+            }
+            std::vector<std::vector<int>> by_root(m);
+            for (int e = 0; e < m; e++) {
+                by_root[block.leader(e)].push_back(edges[e].first);
+                by_root[block.leader(e)].push_back(edges[e].second);
+            }
+            std::vector<char> has_edge(n, false);
+            for (auto [a, b] : edges) has_edge[a] = has_edge[b] = true;
+            for (auto& vs : by_root) {
+                if (vs.empty()) continue;
+                std::sort(vs.begin(), vs.end());
+                vs.erase(std::unique(vs.begin(), vs.end()), vs.end());
+                blocks.push_back(vs);
+            }
+            for (int v = 0; v < n; v++) {
+                if (!has_edge[v]) blocks.push_back({v});
+            }
+        }
+        ASSERT_EQ(normalize(blocks), normalize(ll.biconnected_components()));
+    }
+}
+
+TEST(GraphTest, ThreeEdgeConnected) {
+    Random gen(3);
+    for (int i = 0; i < 300; i++) {
+        int n = gen.uniform(1, 8), m = gen.uniform(0, 14);
+        Edges edges = random_graph(gen, n, m, true);
+        // u, v are 3-edge-connected iff no set of at most 2 edges separates them
+        std::vector<UnionFind> cuts = {components(n, edges, {})};
+        for (int e = 0; e < m; e++) {
+            for (int f = e; f < m; f++) cuts.push_back(components(n, edges, {e, f}));
+        }
+        auto expect = classes(n, [&](int u, int v) {
+            for (auto& uf : cuts) {
+                if (!uf.same(u, v)) return false;
+            }
+            return true;
+        });
+        ASSERT_EQ(normalize(expect),
+                  normalize(three_edge_connected_components(CSRGraph::undirected(n, edges))));
+    }
+}
+
+TEST(GraphTest, LongPath) {
+    // 2^18 deep, a recursive DFS overflows the default stack here
+    int n = 1 << 18;
+    Edges edges;
+    for (int i = 1; i < n; i++) edges.emplace_back(i - 1, i);
+    edges.emplace_back(n - 1, 0);
+    ASSERT_EQ(1u, strongly_connected_components(CSRGraph::directed(n, edges)).size());
+    CSRGraph g = CSRGraph::undirected(n, edges);
+    LowLink ll(g);
+    ASSERT_TRUE(ll.bridges().empty());
+    ASSERT_EQ(1u, ll.two_edge_connected_components().size());
+    ASSERT_EQ(1u, ll.biconnected_components().size());
+    ASSERT_EQ(n, int(three_edge_connected_components(g).size()));
+}
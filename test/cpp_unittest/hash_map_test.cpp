@@ -0,0 +1,50 @@
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "hash_map.h"
+#include "random.h"
+
+using namespace library_checker;
+
+TEST(HashMapTest, Random) {
+    Random gen(1);
+    for (long long range : {10LL, 1000LL, 1LL << 40}) {
+        HashMap<long long, int> mp;
+        std::map<long long, int> expect;
+        for (int i = 0; i < 100000; i++) {
+            long long key = gen.uniform(-range, range);
+            int ty = gen.uniform(0, 3);
+            if (ty == 0) {
+                int v = gen.uniform(0, 1000);
+                mp[key] = v;
+                expect[key] = v;
+            } else if (ty == 1) {
+                ASSERT_EQ(expect.erase(key) == 1, mp.erase(key));
+            } else {
+                auto it = expect.find(key);
+                const int* v = mp.find(key);
+                ASSERT_EQ(it != expect.end(), v != nullptr);
+                ASSERT_EQ(it != expect.end(), mp.contains(key));
+                if (v) {
+                    ASSERT_EQ(it->second, *v);
+                }
+            }
+            ASSERT_EQ(expect.size(), mp.size());
+        }
+        std::map<long long, int> all;
+        mp.for_each([&](long long k, int v) { all[k] = v; });
+        ASSERT_EQ(expect, all);
+    }
+}
+
+TEST(HashMapTest, Reserve) {
+    HashMap<std::uint64_t, std::vector<int>> mp(1000);
+    // keys that collide under the identity hash
+    for (std::uint64_t i = 0; i < 1000; i++) mp[i << 32].push_back(int(i));
+    for (std::uint64_t i = 0; i < 1000; i++) {
+        ASSERT_EQ(std::vector<int>{int(i)}, *mp.find(i << 32));
+    }
+    ASSERT_EQ(nullptr, mp.find(1));
+}
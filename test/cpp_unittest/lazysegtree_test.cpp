@@ -0,0 +1,107 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "lazysegtree.h"
+#include "random.h"
+
+using namespace library_checker;
+
+// possibly empty [l, r) in [0, n]
+std::pair<int, int> random_range(Random& gen, int n) {
+    int l = gen.uniform(0, n), r = gen.uniform(0, n);
+    if (l > r) std::swap(l, r);
+    return {l, r};
+}
+
+template <std::uint32_t MOD> void test_affine_sum() {
+    using AS = AffineSum<MOD>;
+    Random gen(MOD);
+    for (int n : {0, 1, 2, 3, 7, 8, 9, 33}) {
+        std::vector<std::uint32_t> naive(n);
+        std::vector<typename AS::S> v(n);
+        for (int i = 0; i < n; i++) {
+            naive[i] = gen.uniform(0u, MOD - 1);
+            v[i] = AS::leaf(naive[i]);
+        }
+        typename AS::Tree seg(v);
+        for (int ph = 0; ph < 300; ph++) {
+            auto lr = random_range(gen, n);
+            int l = lr.first, r = lr.second;
+            int ty = gen.uniform(0, 2);
+            if (ty == 0) {
+                std::uint32_t a = gen.uniform(0u, MOD - 1);
+                std::uint32_t b = gen.uniform(0u, MOD - 1);
+                seg.apply(l, r, AS::affine(a, b));
+                for (int i = l; i < r; i++) {
+                    naive[i] = std::uint32_t((std::uint64_t(a) * naive[i] + b) % MOD);
+                }
+            } else if (ty == 1) {
+                std::uint64_t sum = 0;
+                for (int i = l; i < r; i++) sum += naive[i];
+                ASSERT_EQ(sum % MOD, AS::value(seg.prod(l, r)));
+            } else {
+                std::vector<std::pair<int, int>> queries;
+                for (int i = 0; i < 5; i++) queries.push_back(random_range(gen, n));
+                auto res = seg.prod_batch(queries);
+                ASSERT_EQ(queries.size(), res.size());
+                for (size_t i = 0; i < queries.size(); i++) {
+                    std::uint64_t sum = 0;
+                    for (int j = queries[i].first; j < queries[i].second; j++) sum += naive[j];
+                    ASSERT_EQ(sum % MOD, AS::value(res[i]));
+                }
+            }
+        }
+    }
+}
+
+TEST(LazySegTreeTest, AffineSum998244353) { test_affine_sum<998244353>(); }
+TEST(LazySegTreeTest, AffineSum1000000007) { test_affine_sum<1000000007>(); }
+TEST(LazySegTreeTest, AffineSum3) { test_affine_sum<3>(); }
+
+// range add, range sum of non-negative values
+struct Node {
+    long long sum;
+    int len;
+};
+Node op_node(Node a, Node b) { return {a.sum + b.sum, a.len + b.len}; }
+Node e_node() { return {0, 0}; }
+Node mapping_add(long long f, Node x) { return {x.sum + f * x.len, x.len}; }
+long long composition_add(long long f, long long g) { return f + g; }
+long long id_add() { return 0; }
+
+TEST(LazySegTreeTest, MaxRightMinLeft) {
+    using Tree = LazySegTree<Node, op_node, e_node, long long, mapping_add,
+                             composition_add, id_add>;
+    Random gen(1);
+    for (int n : {0, 1, 2, 5, 8, 13, 32}) {
+        std::vector<long long> naive(n);
+        std::vector<Node> v(n);
+        for (int i = 0; i < n; i++) {
+            naive[i] = gen.uniform(0, 10);
+            v[i] = {naive[i], 1};
+        }
+        Tree seg(v);
+        for (int ph = 0; ph < 300; ph++) {
+            if (gen.uniform_bool()) {
+                auto lr = random_range(gen, n);
+                long long x = gen.uniform(0, 10);
+                seg.apply(lr.first, lr.second, x);
+                for (int i = lr.first; i < lr.second; i++) naive[i] += x;
+            }
+            long long bound = gen.uniform(0, 100);
+            auto g = [&](Node x) { return x.sum <= bound; };
+            int l = gen.uniform(0, n);
+            int r = l;
+            long long sum = 0;
+            while (r < n && sum + naive[r] <= bound) sum += naive[r++];
+            ASSERT_EQ(r, seg.max_right(l, g));
+            r = gen.uniform(0, n);
+            l = r;
+            sum = 0;
+            while (l > 0 && sum + naive[l - 1] <= bound) sum += naive[--l];
+            ASSERT_EQ(l, seg.min_left(r, g));
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "matrix.h"
+#include "random.h"
+
+using namespace library_checker;
+
+template <std::uint32_t MOD>
+Matrix<MOD> naive_multiply(const Matrix<MOD>& a, const Matrix<MOD>& b) {
+    Matrix<MOD> c(a.h, b.w);
+    for (int i = 0; i < a.h; i++) {
+        for (int j = 0; j < b.w; j++) {
+            std::uint64_t sum = 0;
+            for (int k = 0; k < a.w; k++) {
+                sum = (sum + std::uint64_t(a[i][k]) * b[k][j]) % MOD;
+            }
+            c[i][j] = std::uint32_t(sum);
+        }
+    }
+    return c;
+}
+
+template <std::uint32_t MOD>
+Matrix<MOD> random_matrix(Random& gen, int h, int w) {
+    Matrix<MOD> a(h, w);
+    for (auto& x : a.a) x = gen.uniform(0u, MOD - 1);
+    return a;
+}
+
+template <std::uint32_t MOD> void test_multiply(int threads) {
+    Random gen(MOD);
+    for (int n : {0, 1, 3, 4, 5, 17}) {
+        for (int m : {0, 1, 7, 8, 9, 40}) {
+            for (int k : {0, 1, 7, 8, 9, 70}) {
+                auto a = random_matrix<MOD>(gen, n, m);
+                auto b = random_matrix<MOD>(gen, m, k);
+                ASSERT_EQ(naive_multiply(a, b), multiply(a, b, threads));
+            }
+        }
+    }
+    // all MOD - 1, the largest lazy sums
+    Matrix<MOD> a(33, 300), b(300, 20);
+    for (auto& x : a.a) x = MOD - 1;
+    for (auto& x : b.a) x = MOD - 1;
+    ASSERT_EQ(naive_multiply(a, b), multiply(a, b, threads));
+}
+
+TEST(MatrixTest, Multiply998244353) { test_multiply<998244353>(1); }
+TEST(MatrixTest, Multiply998244353Scalar) {
+    DisableCpuFeature scalar(CpuFeature::avx2);
+    test_multiply<998244353>(1);
+}
+TEST(MatrixTest, Multiply998244353Threads) { test_multiply<998244353>(3); }
+TEST(MatrixTest, Multiply1000000007) { test_multiply<1000000007>(1); }
+TEST(MatrixTest, Multiply1073741789) { test_multiply<1073741789>(1); }
+TEST(MatrixTest, Multiply3) { test_multiply<3>(2); }
+
+TEST(MatrixTest, Power) {
+    constexpr std::uint32_t MOD = 998244353;
+    Random gen(1);
+    auto a = random_matrix<MOD>(gen, 13, 13);
+    auto expect = Matrix<MOD>::identity(13);
+    for (int k = 0; k <= 20; k++) {
+        ASSERT_EQ(expect, power(a, k));
+        expect = naive_multiply(expect, a);
+    }
+}
+
+template <std::uint32_t MOD> void test_inverse() {
+    Random gen(2);
+    for (int n : {0, 1, 2, 7, 8, 9, 50}) {
+        auto a = random_matrix<MOD>(gen, n, n);
+        auto b = inverse(a);
+        ASSERT_TRUE(b);
+        ASSERT_EQ(Matrix<MOD>::identity(n), naive_multiply(a, *b));
+    }
+    // rank deficient
+    auto a = random_matrix<MOD>(gen, 20, 20);
+    for (int j = 0; j < 20; j++) {
+        a[19][j] = std::uint32_t((a[3][j] * 5ull + a[7][j]) % MOD);
+    }
+    ASSERT_FALSE(inverse(a));
+}
+
+TEST(MatrixTest, Inverse) { test_inverse<998244353>(); }
+TEST(MatrixTest, InverseScalar) {
+    DisableCpuFeature scalar(CpuFeature::avx2);
+    test_inverse<998244353>();
+}
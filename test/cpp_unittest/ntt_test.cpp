@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ntt.h"
+#include "random.h"
+
+using namespace library_checker;
+
+template <std::uint32_t MOD>
+std::vector<std::uint32_t> naive_multiply(const std::vector<std::uint32_t>& a,
+                                          const std::vector<std::uint32_t>& b) {
+    if (a.empty() || b.empty()) return {};
+    std::vector<std::uint32_t> c(a.size() + b.size() - 1);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j = 0; j < b.size(); j++) {
+            c[i + j] = std::uint32_t((c[i + j] + std::uint64_t(a[i]) * b[j]) % MOD);
+        }
+    }
+    return c;
+}
+
+template <std::uint32_t MOD>
+std::vector<std::uint32_t> random_vector(Random& gen, int n) {
+    std::vector<std::uint32_t> a(n);
+    for (auto& x : a) x = gen.uniform(0u, MOD - 1);
+    return a;
+}
+
+template <std::uint32_t MOD> void test_multiply() {
+    Random gen(MOD);
+    for (int n = 0; n <= 80; n++) {
+        for (int m : {0, 1, 2, 31, 32, 33, 64, 80}) {
+            auto a = random_vector<MOD>(gen, n);
+            auto b = random_vector<MOD>(gen, m);
+            ASSERT_EQ(naive_multiply<MOD>(a, b), multiply<MOD>(a, b));
+        }
+    }
+    for (int n : {300, 511, 512, 513, 1000}) {
+        auto a = random_vector<MOD>(gen, n);
+        auto b = random_vector<MOD>(gen, n / 2 + 1);
+        ASSERT_EQ(naive_multiply<MOD>(a, b), multiply<MOD>(a, b));
+    }
+    // all MOD - 1
+    std::vector<std::uint32_t> a(1000, MOD - 1), b(1000, MOD - 1);
+    ASSERT_EQ(naive_multiply<MOD>(a, b), multiply<MOD>(a, b));
+}
+
+TEST(NTTTest, Multiply998244353) { test_multiply<998244353>(); }
+TEST(NTTTest, Multiply998244353Scalar) {
+    DisableCpuFeature scalar(CpuFeature::avx2);
+    test_multiply<998244353>();
+}
+TEST(NTTTest, MultiplyModInt) {
+    struct ModInt {
+        std::uint32_t v = 0;
+    };
+    constexpr std::uint32_t MOD = 998244353;
+    Random gen(2);
+    auto a = random_vector<MOD>(gen, 100), b = random_vector<MOD>(gen, 77);
+    std::vector<ModInt> a2(a.size()), b2(b.size());
+    for (size_t i = 0; i < a.size(); i++) a2[i].v = a[i];
+    for (size_t i = 0; i < b.size(); i++) b2[i].v = b[i];
+    auto expected = multiply<MOD>(a, b);
+    auto actual = multiply<MOD>(a2, b2);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) ASSERT_EQ(expected[i], actual[i].v);
+}
+TEST(NTTTest, Multiply754974721) { test_multiply<754974721>(); }
+TEST(NTTTest, Multiply167772161) { test_multiply<167772161>(); }
+TEST(NTTTest, Multiply469762049) { test_multiply<469762049>(); }
+
+TEST(NTTTest, MiddleProduct) {
+    constexpr std::uint32_t MOD = 998244353;
+    Random gen(1);
+    for (int n = 1; n <= 100; n++) {
+        for (int m = 1; m <= n; m += 7) {
+            auto a = random_vector<MOD>(gen, n);
+            auto b = random_vector<MOD>(gen, m);
+            std::vector<std::uint32_t> expect(n - m + 1);
+            for (int i = 0; i <= n - m; i++) {
+                std::uint64_t sum = 0;
+                for (int j = 0; j < m; j++) {
+                    sum = (sum + std::uint64_t(a[i + j]) * b[j]) % MOD;
+                }
+                expect[i] = std::uint32_t(sum);
+            }
+            ASSERT_EQ(expect, middle_product<MOD>(a, b));
+        }
+    }
+}
+
+TEST(NTTTest, TransformInverse) {
+    constexpr std::uint32_t MOD = 998244353;
+    Random gen(2);
+    for (int lg = 0; lg <= 12; lg++) {
+        int n = 1 << lg;
+        auto a = random_vector<MOD>(gen, n);
+        auto b = a;
+        NTT<MOD>::transform(b.data(), n);
+        // b[bitrev(1)] = a(w) for the primitive n-th root w
+        NTT<MOD>::inverse_transform(b.data(), n);
+        for (int i = 0; i < n; i++) {
+            ASSERT_EQ(std::uint64_t(a[i]) * n % MOD, b[i]);
+        }
+    }
+}
+
+TEST(NTTTest, ScalarAndVector) {
+    constexpr std::uint32_t MOD = 998244353;
+    Random gen(3);
+    for (int lg = 0; lg <= 14; lg++) {
+        int n = 1 << lg;
+        auto a = random_vector<MOD>(gen, n);
+        auto b = a;
+        {
+            DisableCpuFeature scalar(CpuFeature::avx2);
+            NTT<MOD>::transform(a.data(), n);
+        }
+        NTT<MOD>::transform(b.data(), n);
+        ASSERT_EQ(a, b);
+    }
+}
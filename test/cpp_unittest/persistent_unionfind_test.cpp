@@ -0,0 +1,65 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "persistent_unionfind.h"
+#include "random.h"
+#include "unionfind.h"
+
+using namespace library_checker;
+
+TEST(PersistentUnionFindTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 7, 8, 9, 64, 65, 300}) {
+        PersistentUnionFind uf(n);
+        // a full copy of every version
+        std::vector<PersistentUnionFind::Version> ver = {uf.initial()};
+        std::vector<UnionFind> expect = {UnionFind(n)};
+        for (int i = 0; i < 500; i++) {
+            int k = gen.uniform(0, int(ver.size()) - 1);
+            int a = gen.uniform(0, n - 1), b = gen.uniform(0, n - 1);
+            if (gen.uniform_bool()) {
+                UnionFind next = expect[k];
+                next.merge(a, b);
+                ver.push_back(uf.merge(ver[k], a, b));
+                expect.push_back(next);
+            } else {
+                ASSERT_EQ(expect[k].same(a, b), uf.same(ver[k], a, b));
+                ASSERT_EQ(expect[k].size(a), uf.size(ver[k], a));
+            }
+        }
+        // older versions are unchanged by the later merges
+        for (int k = 0; k < int(ver.size()); k++) {
+            for (int a = 0; a < n; a++) {
+                ASSERT_EQ(expect[k].size(a), uf.size(ver[k], a));
+            }
+        }
+    }
+}
+
+TEST(RollbackUnionFindTest, Random) {
+    Random gen(2);
+    for (int n : {1, 2, 10, 100}) {
+        RollbackUnionFind uf(n);
+        std::vector<UnionFind> saved = {UnionFind(n)};
+        std::vector<int> snaps = {uf.snapshot()};
+        UnionFind cur(n);
+        for (int i = 0; i < 2000; i++) {
+            int a = gen.uniform(0, n - 1), b = gen.uniform(0, n - 1);
+            int ty = gen.uniform(0, 3);
+            if (ty == 0) {
+                ASSERT_EQ(cur.merge(a, b), uf.merge(a, b));
+            } else if (ty == 1) {
+                saved.push_back(cur);
+                snaps.push_back(uf.snapshot());
+            } else if (ty == 2 && snaps.size() > 1) {
+                uf.rollback(snaps.back());
+                cur = saved.back();
+                snaps.pop_back();
+                saved.pop_back();
+            } else {
+                ASSERT_EQ(cur.same(a, b), uf.same(a, b));
+                ASSERT_EQ(cur.size(a), uf.size(a));
+            }
+        }
+    }
+}
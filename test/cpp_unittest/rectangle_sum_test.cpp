@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "rectangle_sum.h"
+
+using namespace library_checker;
+
+struct Point {
+    std::int64_t x, y, w;
+};
+
+std::int64_t naive_sum(const std::vector<Point>& pts, std::int64_t l, std::int64_t d,
+                       std::int64_t r, std::int64_t u) {
+    std::int64_t s = 0;
+    for (auto& p : pts) {
+        if (l <= p.x && p.x < r && d <= p.y && p.y < u) s += p.w;
+    }
+    return s;
+}
+
+TEST(RectangleSumTest, FlatFenwick) {
+    FlatFenwick<int> fw(10);
+    fw.add(3, 5);
+    fw.add(9, 2);
+    fw.sub(3, 1);
+    ASSERT_EQ(0, fw.sum(3));
+    ASSERT_EQ(4, fw.sum(4));
+    ASSERT_EQ(6, fw.sum(10));
+    ASSERT_EQ(2, fw.sum(4, 10));
+}
+
+TEST(RectangleSumTest, Static) {
+    Random gen(1);
+    for (int n : {0, 1, 5, 100}) {
+        for (int coord : {1, 10, 1000000000}) {
+            std::vector<Point> pts(n);
+            StaticRectangleSum<std::int64_t> rs;
+            for (auto& p : pts) {
+                p = {gen.uniform(0, coord), gen.uniform(0, coord), gen.uniform(-100, 100)};
+                rs.add_point(p.x, p.y, p.w);
+            }
+            std::vector<std::int64_t> expect;
+            for (int i = 0; i < 100; i++) {
+                std::int64_t l = gen.uniform(-1, coord + 1), r = gen.uniform(-1, coord + 1);
+                std::int64_t d = gen.uniform(-1, coord + 1), u = gen.uniform(-1, coord + 1);
+                if (l > r) std::swap(l, r);
+                if (d > u) std::swap(d, u);
+                rs.add_query(l, d, r, u);
+                expect.push_back(naive_sum(pts, l, d, r, u));
+            }
+            ASSERT_EQ(expect, rs.solve());
+        }
+    }
+}
+
+TEST(RectangleSumTest, PointAdd) {
+    Random gen(2);
+    for (int n : {0, 1, 5, 50}) {
+        for (int q : {0, 1, 2, 10, 300}) {
+            for (int coord : {3, 1000000000}) {
+                std::vector<Point> pts;
+                PointAddRectangleSum<std::int64_t> rs;
+                auto add = [&]() {
+                    Point p{gen.uniform(0, coord), gen.uniform(0, coord), gen.uniform(-100, 100)};
+                    pts.push_back(p);
+                    rs.add_point(p.x, p.y, p.w);
+                };
+                for (int i = 0; i < n; i++) add();
+                std::vector<std::int64_t> expect;
+                for (int i = 0; i < q; i++) {
+                    if (gen.uniform_bool()) {
+                        add();
+                        continue;
+                    }
+                    std::int64_t l = gen.uniform(0, coord), r = gen.uniform(0, coord);
+                    std::int64_t d = gen.uniform(0, coord), u = gen.uniform(0, coord);
+                    if (l > r) std::swap(l, r);
+                    if (d > u) std::swap(d, u);
+                    rs.add_query(l, d, r, u);
+                    expect.push_back(naive_sum(pts, l, d, r, u));
+                }
+                ASSERT_EQ(expect, rs.solve());
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "rmq.h"
+
+using namespace library_checker;
+
+namespace {
+
+template <class Compare> int naive_argmin(const std::vector<int>& a, int l, int r, Compare comp) {
+    int res = l;
+    for (int i = l + 1; i < r; i++) {
+        if (comp(a[i], a[res])) res = i;
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST(RMQTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 63, 64, 65, 128, 129, 300, 1000}) {
+        for (int max_a : {1, 5, 1000000}) {
+            std::vector<int> a(n);
+            for (int& x : a) x = gen.uniform(0, max_a);
+            RMQ<int> rmq(a);
+            RMQ<int, std::greater<int>> rmq_max(a);
+            ASSERT_EQ(n, rmq.size());
+            for (int i = 0; i < 1000; i++) {
+                auto [l, r] = gen.uniform_pair(0, n);
+                if (l == r) continue;
+                ASSERT_EQ(naive_argmin(a, l, r, std::less<int>()), rmq.argmin(l, r));
+                ASSERT_EQ(a[naive_argmin(a, l, r, std::less<int>())], rmq.min(l, r));
+                ASSERT_EQ(naive_argmin(a, l, r, std::greater<int>()), rmq_max.argmin(l, r));
+            }
+        }
+    }
+}
+
+TEST(RMQTest, AllRanges) {
+    Random gen(2);
+    int n = 200;
+    std::vector<int> a(n);
+    for (int& x : a) x = gen.uniform(0, 10);
+    RMQ<int> rmq(a);
+    for (int l = 0; l < n; l++) {
+        for (int r = l + 1; r <= n; r++) {
+            ASSERT_EQ(naive_argmin(a, l, r, std::less<int>()), rmq.argmin(l, r));
+        }
+    }
+}
+
+TEST(RMQTest, Batch) {
+    Random gen(3);
+    int n = 5000;
+    std::vector<int> a(n);
+    for (int& x : a) x = gen.uniform(-100, 100);
+    RMQ<int> rmq(a);
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < 1000; i++) {
+        auto [l, r] = gen.uniform_pair(0, n);
+        if (l < r) queries.emplace_back(l, r);
+    }
+    std::vector<int> res = rmq.argmin_batch(queries);
+    ASSERT_EQ(queries.size(), res.size());
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        ASSERT_EQ(rmq.argmin(queries[i].first, queries[i].second), res[i]);
+    }
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "short_cycles.h"
+
+using namespace library_checker;
+
+namespace {
+
+std::vector<std::pair<int, int>> simple_graph(Random& gen, int n, int m) {
+    std::set<std::pair<int, int>> used;
+    std::vector<std::pair<int, int>> edges;
+    m = int(std::min<long long>(m, (long long)n * (n - 1) / 2));
+    while (int(edges.size()) < m) {
+        auto [u, v] = gen.uniform_pair(0, n - 1);
+        if (used.insert({u, v}).second) {
+            if (gen.uniform_bool()) std::swap(u, v);
+            edges.emplace_back(u, v);
+        }
+    }
+    return edges;
+}
+
+// sum of x[a] x[b] x[c] over the triangles, and their number
+std::pair<std::uint32_t, std::uint64_t> naive_triangles(int n,
+                                                        const std::vector<std::pair<int, int>>& edges,
+                                                        const std::vector<std::uint32_t>& x,
+                                                        std::uint32_t mod) {
+    std::vector<std::vector<char>> adj(n, std::vector<char>(n, false));
+    for (auto [u, v] : edges) adj[u][v] = adj[v][u] = true;
+    std::uint64_t sum = 0, cnt = 0;
+    for (int a = 0; a < n; a++) {
+        for (int b = a + 1; b < n; b++) {
+            if (!adj[a][b]) continue;
+            for (int c = b + 1; c < n; c++) {
+                if (!adj[a][c] || !adj[b][c]) continue;
+                cnt++;
+                sum = (sum + std::uint64_t(x[a]) * x[b] % mod * x[c]) % mod;
+            }
+        }
+    }
+    return {std::uint32_t(sum), cnt};
+}
+
+// for each edge e, the 4-cycles through it: pick the opposite edge f
+// disjoint from e, and the two edges closing the cycle on either side
+std::vector<long long> naive_c4(int n, const std::vector<std::pair<int, int>>& edges) {
+    int m = int(edges.size());
+    std::vector<std::vector<long long>> mult(n, std::vector<long long>(n, 0));
+    for (auto [u, v] : edges) {
+        mult[u][v]++;
+        mult[v][u]++;
+    }
+    std::vector<long long> res(m, 0);
+    for (int e = 0; e < m; e++) {
+        auto [a, b] = edges[e];
+        // cycles a - b - c - d - a
+        for (int c = 0; c < n; c++) {
+            for (int d = 0; d < n; d++) {
+                if (c == a || c == b || d == a || d == b || c == d) continue;
+                res[e] += mult[b][c] * mult[c][d] * mult[d][a];
+            }
+        }
+    }
+    return res;
+}
+
+}  // namespace
+
+TEST(ShortCyclesTest, DegreeOrderedGraph) {
+    Random gen(1);
+    int n = 50;
+    auto edges = simple_graph(gen, n, 300);
+    DegreeOrderedGraph g(n, edges);
+    ASSERT_EQ(n, g.size());
+    ASSERT_EQ(300, g.num_edges());
+    for (int r = 0; r + 1 < n; r++) ASSERT_LE(g.degree(r), g.degree(r + 1));
+    for (int r = 0; r < n; r++) {
+        ASSERT_EQ(r, g.rank[g.vertex[r]]);
+        for (auto a : g.lower(r)) ASSERT_LT(a.to, r);
+        for (auto a : g.higher(r)) ASSERT_GT(a.to, r);
+        ASSERT_EQ(g.degree(r), g.lower(r).size() + g.higher(r).size());
+        auto arcs = g[r];
+        for (auto a = arcs.begin(); a != arcs.end(); a++) {
+            if (a + 1 != arcs.end()) {
+                ASSERT_LT(a->to, (a + 1)->to);
+            }
+            auto [u, v] = edges[g.edge[a->id]];
+            ASSERT_EQ(std::minmax(r, a->to), std::minmax(g.rank[u], g.rank[v]));
+        }
+    }
+}
+
+TEST(ShortCyclesTest, TrianglesRandom) {
+    Random gen(1);
+    const std::uint32_t mod = 998244353;
+    for (int iter = 0; iter < 300; iter++) {
+        int n = gen.uniform(1, 40);
+        auto edges = simple_graph(gen, n, gen.uniform(0, n * n / 2));
+        std::vector<std::uint32_t> x(n);
+        for (auto& v : x) v = gen.uniform<std::uint32_t>(0, mod - 1);
+        auto [sum, cnt] = naive_triangles(n, edges, x, mod);
+        TriangleCounter tc(n, edges);
+        ASSERT_EQ(sum, tc.weighted_sum(x, mod));
+        ASSERT_EQ(cnt, tc.count());
+        DisableCpuFeature generic(CpuFeature::popcnt);
+        ASSERT_EQ(cnt, tc.count());
+    }
+}
+
+TEST(ShortCyclesTest, TrianglesDense) {
+    // a complete graph with a few edges removed, plus a sparse fringe: the
+    // heavy rows span several words
+    Random gen(1);
+    int core = 300, n = 1000;
+    std::vector<std::pair<int, int>> edges;
+    for (int u = 0; u < core; u++) {
+        for (int v = u + 1; v < core; v++) {
+            if (gen.uniform(0, 9)) edges.emplace_back(u, v);
+        }
+    }
+    for (int i = 0; i < 3000; i++) {
+        int u = gen.uniform(core, n - 1), v = gen.uniform(0, n - 1);
+        if (v < core || v > u) edges.emplace_back(u, v);
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    std::vector<std::uint32_t> x(n);
+    for (auto& v : x) v = gen.uniform<std::uint32_t>(0, 1'000'000'006);
+    auto [sum, cnt] = naive_triangles(n, edges, x, 1'000'000'007);
+    TriangleCounter tc(n, edges);
+    for (int threads : {1, 2, 4}) {
+        ASSERT_EQ(sum, tc.weighted_sum(x, 1'000'000'007, threads));
+        ASSERT_EQ(cnt, tc.count(threads));
+    }
+}
+
+TEST(ShortCyclesTest, C4Random) {
+    Random gen(1);
+    for (int iter = 0; iter < 300; iter++) {
+        int n = gen.uniform(2, 12);
+        int m = gen.uniform(1, 40);
+        std::vector<std::pair<int, int>> edges(m);
+        for (auto& e : edges) {
+            e = gen.uniform_pair(0, n - 1);
+            if (gen.uniform_bool()) std::swap(e.first, e.second);
+        }
+        ASSERT_EQ(naive_c4(n, edges), c4_counts(n, edges));
+    }
+}
+
+TEST(ShortCyclesTest, C4Threads) {
+    Random gen(1);
+    int n = 80;
+    auto edges = simple_graph(gen, n, 1000);
+    for (int i = 0; i < 200; i++) edges.push_back(edges[gen.uniform(0, 999)]);
+    auto expected = naive_c4(n, edges);
+    for (int threads : {1, 3, 8}) ASSERT_EQ(expected, c4_counts(n, edges, threads));
+}
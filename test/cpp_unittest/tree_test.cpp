@@ -0,0 +1,130 @@
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "tree.h"
+
+using namespace library_checker;
+
+namespace {
+
+// parent and depth by BFS from root
+struct NaiveTree {
+    std::vector<int> par, dep;
+    NaiveTree(int n, const std::vector<std::pair<int, int>>& edges, int root)
+        : par(n, -1), dep(n, 0) {
+        std::vector<std::vector<int>> g(n);
+        for (auto [u, v] : edges) {
+            g[u].push_back(v);
+            g[v].push_back(u);
+        }
+        std::vector<int> order = {root};
+        for (int i = 0; i < int(order.size()); i++) {
+            int v = order[i];
+            for (int to : g[v]) {
+                if (to == par[v]) continue;
+                par[to] = v;
+                dep[to] = dep[v] + 1;
+                order.push_back(to);
+            }
+        }
+    }
+    int ancestor(int v, int k) const {
+        if (k > dep[v]) return -1;
+        while (k--) v = par[v];
+        return v;
+    }
+    int lca(int u, int v) const {
+        if (dep[u] < dep[v]) std::swap(u, v);
+        u = ancestor(u, dep[u] - dep[v]);
+        while (u != v) {
+            u = par[u];
+            v = par[v];
+        }
+        return u;
+    }
+    // the path from u to v
+    std::vector<int> path(int u, int v) const {
+        int c = lca(u, v);
+        std::vector<int> res, rest;
+        for (; u != c; u = par[u]) res.push_back(u);
+        res.push_back(c);
+        for (; v != c; v = par[v]) rest.push_back(v);
+        res.insert(res.end(), rest.rbegin(), rest.rend());
+        return res;
+    }
+};
+
+std::vector<std::pair<int, int>> random_tree(Random& gen, int n, int type) {
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 1; i < n; i++) {
+        int p;
+        if (type == 0) {
+            p = gen.uniform(0, i - 1);
+        } else if (type == 1) {
+            p = i - 1;  // path
+        } else if (type == 2) {
+            p = gen.uniform(std::max(0, i - 3), i - 1);  // long and thin
+        } else {
+            p = 0;  // star
+        }
+        edges.emplace_back(p, i);
+    }
+    std::vector<int> perm = gen.perm<int>(n);
+    for (auto& [u, v] : edges) {
+        u = perm[u];
+        v = perm[v];
+        if (gen.uniform_bool()) std::swap(u, v);
+    }
+    return edges;
+}
+
+}  // namespace
+
+TEST(TreeQueryTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 3, 10, 100, 500}) {
+        for (int type = 0; type < 4; type++) {
+            auto edges = random_tree(gen, n, type);
+            int root = gen.uniform(0, n - 1);
+            TreeQuery tree(n, edges, root);
+            NaiveTree naive(n, edges, root);
+            ASSERT_EQ(n, tree.size());
+            for (int v = 0; v < n; v++) {
+                ASSERT_EQ(naive.par[v], tree.parent(v));
+                ASSERT_EQ(naive.dep[v], tree.depth(v));
+                for (int k = 0; k <= naive.dep[v] + 1; k++) {
+                    ASSERT_EQ(naive.ancestor(v, k), tree.level_ancestor(v, k));
+                }
+            }
+            std::vector<std::pair<int, int>> queries;
+            for (int i = 0; i < 300; i++) {
+                int u = gen.uniform(0, n - 1), v = gen.uniform(0, n - 1);
+                queries.emplace_back(u, v);
+                ASSERT_EQ(naive.lca(u, v), tree.lca(u, v));
+                std::vector<int> path = naive.path(u, v);
+                ASSERT_EQ(int(path.size()) - 1, tree.dist(u, v));
+                for (int k = 0; k <= int(path.size()); k++) {
+                    ASSERT_EQ(k < int(path.size()) ? path[k] : -1, tree.jump(u, v, k));
+                }
+            }
+            std::vector<int> res = tree.lca_batch(queries);
+            for (std::size_t i = 0; i < queries.size(); i++) {
+                ASSERT_EQ(naive.lca(queries[i].first, queries[i].second), res[i]);
+            }
+        }
+    }
+}
+
+TEST(TreeQueryTest, LongPath) {
+    // no recursion on a path of 10^6 vertices
+    int n = 1000000;
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 1; i < n; i++) edges.emplace_back(i - 1, i);
+    TreeQuery tree(n, edges, 0);
+    ASSERT_EQ(n - 1, tree.depth(n - 1));
+    ASSERT_EQ(12345, tree.lca(12345, n - 1));
+    ASSERT_EQ(n - 1 - 777777, tree.level_ancestor(n - 1, 777777));
+    ASSERT_EQ(3, tree.jump(n - 1, 0, n - 4));
+}
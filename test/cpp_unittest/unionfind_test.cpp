@@ -0,0 +1,149 @@
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "unionfind.h"
+
+using namespace library_checker;
+
+namespace {
+
+// component ids by relabeling, O(n) per merge
+struct NaiveUnionFind {
+    std::vector<int> id;
+    explicit NaiveUnionFind(int n) : id(n) {
+        for (int i = 0; i < n; i++) id[i] = i;
+    }
+    bool merge(int a, int b) {
+        int x = id[a], y = id[b];
+        if (x == y) return false;
+        for (int& c : id) {
+            if (c == y) c = x;
+        }
+        return true;
+    }
+    bool same(int a, int b) const { return id[a] == id[b]; }
+    int size(int a) const {
+        int s = 0;
+        for (int c : id) s += c == id[a];
+        return s;
+    }
+};
+
+// 2x2 integer matrices mod 7 with determinant 1, a non-commutative group
+using Mat = std::array<int, 4>;
+Mat mat_id() { return {1, 0, 0, 1}; }
+Mat mat_op(const Mat& a, const Mat& b) {
+    return {(a[0] * b[0] + a[1] * b[2]) % 7, (a[0] * b[1] + a[1] * b[3]) % 7,
+            (a[2] * b[0] + a[3] * b[2]) % 7, (a[2] * b[1] + a[3] * b[3]) % 7};
+}
+Mat mat_inv(const Mat& a) { return {a[3], (7 - a[1]) % 7, (7 - a[2]) % 7, a[0]}; }
+
+Mat random_mat(Random& gen) {
+    while (true) {
+        Mat m;
+        for (int& x : m) x = gen.uniform(0, 6);
+        if (((m[0] * m[3] - m[1] * m[2]) % 7 + 7) % 7 == 1) return m;
+    }
+}
+
+}  // namespace
+
+TEST(UnionFindTest, Random) {
+    Random gen(1);
+    for (int n : {1, 2, 10, 100}) {
+        UnionFind uf(n);
+        NaiveUnionFind naive(n);
+        int groups = n;
+        for (int i = 0; i < 1000; i++) {
+            int a = gen.uniform(0, n - 1), b = gen.uniform(0, n - 1);
+            if (gen.uniform_bool()) {
+                bool merged = naive.merge(a, b);
+                ASSERT_EQ(merged, uf.merge(a, b));
+                groups -= merged;
+            } else {
+                ASSERT_EQ(naive.same(a, b), uf.same(a, b));
+            }
+            ASSERT_EQ(naive.size(a), uf.size(a));
+            ASSERT_EQ(groups, uf.count());
+        }
+    }
+}
+
+TEST(UnionFindTest, LongPath) {
+    // a chain of parents deep enough to overflow a recursive find
+    int n = 1 << 20;
+    UnionFind uf(n);
+    for (int i = 1; i < n; i++) uf.merge(i, i - 1);
+    ASSERT_EQ(n, uf.size(n - 1));
+    ASSERT_TRUE(uf.same(0, n - 1));
+    ASSERT_EQ(1, uf.count());
+}
+
+TEST(UnionFindTest, Batch) {
+    Random gen(2);
+    int n = 1000;
+    UnionFind uf(n), uf2(n);
+    for (int round = 0; round < 20; round++) {
+        std::vector<std::pair<int, int>> merges(gen.uniform(0, 30)), queries(100);
+        for (auto& [a, b] : merges) {
+            a = gen.uniform(0, n - 1);
+            b = gen.uniform(0, n - 1);
+        }
+        for (auto& [a, b] : queries) {
+            a = gen.uniform(0, n - 1);
+            b = gen.uniform(0, n - 1);
+        }
+        uf.merge_all(merges);
+        for (auto [a, b] : merges) uf2.merge(a, b);
+        std::vector<char> res = uf.same_all(queries);
+        ASSERT_EQ(queries.size(), res.size());
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            ASSERT_EQ(uf2.same(queries[i].first, queries[i].second), bool(res[i]));
+        }
+        ASSERT_EQ(uf2.count(), uf.count());
+    }
+}
+
+TEST(PotentialUnionFindTest, NonCommutative) {
+    Random gen(3);
+    for (int n : {1, 2, 10, 100}) {
+        // hidden potentials; merges are consistent with them or random
+        std::vector<Mat> pot(n);
+        for (Mat& m : pot) m = random_mat(gen);
+        PotentialUnionFind<Mat, mat_id, mat_op, mat_inv> uf(n);
+        NaiveUnionFind naive(n);
+        for (int i = 0; i < 1000; i++) {
+            int a = gen.uniform(0, n - 1), b = gen.uniform(0, n - 1);
+            Mat expect = mat_op(mat_inv(pot[a]), pot[b]);
+            if (gen.uniform_bool()) {
+                bool consistent = gen.uniform(0, 3) != 0;
+                Mat d = consistent ? expect : random_mat(gen);
+                bool ok = !naive.same(a, b) || d == expect;
+                if (!naive.same(a, b) && !consistent) {
+                    // the new edge decides the potentials, don't merge
+                    continue;
+                }
+                naive.merge(a, b);
+                ASSERT_EQ(ok, uf.merge(a, b, d));
+            } else {
+                ASSERT_EQ(naive.same(a, b), uf.same(a, b));
+                if (naive.same(a, b)) {
+                    ASSERT_EQ(expect, uf.diff(a, b));
+                }
+            }
+        }
+    }
+}
+
+TEST(PotentialUnionFindTest, LongPath) {
+    int n = 1 << 20;
+    PotentialUnionFind<Mat, mat_id, mat_op, mat_inv> uf(n);
+    Mat step = {1, 1, 0, 1};
+    for (int i = 1; i < n; i++) ASSERT_TRUE(uf.merge(i, i - 1, mat_inv(step)));
+    Mat expect = mat_id();
+    for (int i = 0; i < (n - 1) % 7; i++) expect = mat_op(expect, step);
+    ASSERT_EQ(expect, uf.diff(0, n - 1));
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "random.h"
+#include "wavelet_matrix.h"
+
+using namespace library_checker;
+
+TEST(WaveletMatrixTest, BitVector) {
+    Random gen(1);
+    for (int n : {0, 1, 63, 64, 65, 511, 512, 513, 5000, 20000}) {
+        for (int density : {0, 1, 50, 99, 100}) {
+            std::vector<bool> a(n);
+            BitVector v(n);
+            for (int i = 0; i < n; i++) {
+                a[i] = gen.uniform(0, 99) < density;
+                if (a[i]) v.set(i);
+            }
+            v.build();
+            std::size_t ones = 0, zeros = 0;
+            for (int i = 0; i < n; i++) {
+                ASSERT_EQ(ones, v.rank1(i));
+                ASSERT_EQ(zeros, v.rank0(i));
+                ASSERT_EQ(a[i], v[i]);
+                if (a[i]) {
+                    ASSERT_EQ(std::size_t(i), v.select1(ones++));
+                } else {
+                    ASSERT_EQ(std::size_t(i), v.select0(zeros++));
+                }
+            }
+            ASSERT_EQ(ones, v.rank1(n));
+            ASSERT_EQ(ones, v.count1());
+            ASSERT_EQ(zeros, v.count0());
+        }
+    }
+}
+
+void test_queries(int threads) {
+    Random gen(2);
+    for (int n : {0, 1, 2, 10, 100, 1000}) {
+        for (int bits : {0, 1, 3, 10, 30}) {
+            std::vector<int> a(n);
+            for (auto& x : a) x = gen.uniform(0, (1 << bits) - 1);
+            WaveletMatrix<int> wm(a, bits, threads);
+            ASSERT_EQ(std::size_t(n), wm.size());
+            for (int ph = 0; ph < 100; ph++) {
+                int l = gen.uniform(0, n), r = gen.uniform(0, n);
+                if (l > r) std::swap(l, r);
+                std::vector<int> b(a.begin() + l, a.begin() + r);
+                std::sort(b.begin(), b.end());
+                if (l < r) {
+                    int k = gen.uniform(0, r - l - 1);
+                    ASSERT_EQ(b[k], wm.kth_smallest(l, r, k));
+                    ASSERT_EQ(b[r - l - 1 - k], wm.kth_largest(l, r, k));
+                }
+                int x = n ? a[gen.uniform(0, n - 1)] : 0;
+                ASSERT_EQ(std::size_t(std::count(a.begin(), a.begin() + r, x)), wm.rank(x, r));
+                int lower = gen.uniform(-1, (1 << bits) + 1);
+                int upper = gen.uniform(-1, (1 << bits) + 1);
+                std::size_t freq = 0;
+                for (int y : b) freq += (lower <= y && y < upper);
+                ASSERT_EQ(freq, wm.range_freq(l, r, lower, upper));
+
+                auto it = std::lower_bound(b.begin(), b.end(), upper);
+                ASSERT_EQ(it == b.begin() ? std::nullopt : std::optional<int>(*(it - 1)),
+                          wm.prev_value(l, r, upper));
+                it = std::lower_bound(b.begin(), b.end(), lower);
+                ASSERT_EQ(it == b.end() ? std::nullopt : std::optional<int>(*it),
+                          wm.next_value(l, r, lower));
+            }
+        }
+    }
+}
+
+TEST(WaveletMatrixTest, Queries) { test_queries(1); }
+TEST(WaveletMatrixTest, QueriesGeneric) {
+    DisableCpuFeature generic(CpuFeature::popcnt);
+    test_queries(1);
+}
+TEST(WaveletMatrixTest, QueriesThreads) { test_queries(4); }
+
+TEST(WaveletMatrixTest, Unsigned) {
+    std::vector<std::uint64_t> a = {~0ULL, 0, 1ULL << 63, 5};
+    WaveletMatrix<std::uint64_t> wm(a, 64);
+    ASSERT_EQ(0u, wm.kth_smallest(0, 4, 0));
+    ASSERT_EQ(~0ULL, wm.kth_smallest(0, 4, 3));
+    ASSERT_EQ(2u, wm.range_freq(0, 4, 1, ~0ULL));
+}
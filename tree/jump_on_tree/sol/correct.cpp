@@ -1,312 +1,24 @@
-#include <vector>
-#include <cassert>
-#include <algorithm>
 #include <cstdio>
+#include <utility>
+#include <vector>
 
-using namespace std;
-
-using ll = long long;
-using pi = pair<ll, ll>;
-using vi = vector<ll>;
-using u32 = unsigned int;
-using u64 = unsigned long long;
-using i128 = __int128;
-
-template <class T>
-using vc = vector<T>;
-
-// https://trap.jp/post/1224/
-#define FOR1(a) for (ll _ = 0; _ < ll(a); ++_)
-#define FOR2(i, a) for (ll i = 0; i < ll(a); ++i)
-#define FOR3(i, a, b) for (ll i = a; i < ll(b); ++i)
-#define FOR4(i, a, b, c) for (ll i = a; i < ll(b); i += (c))
-#define FOR1_R(a) for (ll i = (a)-1; i >= ll(0); --i)
-#define FOR2_R(i, a) for (ll i = (a)-1; i >= ll(0); --i)
-#define FOR3_R(i, a, b) for (ll i = (b)-1; i >= ll(a); --i)
-#define FOR4_R(i, a, b, c) for (ll i = (b)-1; i >= ll(a); i -= (c))
-#define overload4(a, b, c, d, e, ...) e
-#define FOR(...) overload4(__VA_ARGS__, FOR4, FOR3, FOR2, FOR1)(__VA_ARGS__)
-#define FOR_R(...) \
-  overload4(__VA_ARGS__, FOR4_R, FOR3_R, FOR2_R, FOR1_R)(__VA_ARGS__)
-
-#define all(x) x.begin(), x.end()
-#define len(x) ll(x.size())
-#define elif else if
-
-#define eb emplace_back
-#define mp make_pair
-#define mt make_tuple
-#define fi first
-#define se second
-
-template <class T, class S>
-inline bool chmax(T &a, const S &b) {
-  return (a < b ? a = b, 1 : 0);
-}
-template <class T, class S>
-inline bool chmin(T &a, const S &b) {
-  return (a > b ? a = b, 1 : 0);
-}
-
-template <typename T>
-struct Edge {
-  int frm, to;
-  T cost;
-  int id;
-};
-
-template <typename T = int, bool directed = false>
-struct Graph {
-  int N, M;
-  using cost_type = T;
-  using edge_type = Edge<T>;
-  vector<edge_type> edges;
-  vector<int> indptr;
-  vector<edge_type> csr_edges;
-  bool prepared;
-
-  class OutgoingEdges {
-  public:
-    OutgoingEdges(const Graph *G, int l, int r) : G(G), l(l), r(r) {}
-
-    const edge_type *begin() const {
-      if (l == r) { return 0; }
-      return &G->csr_edges[l];
-    }
-
-    const edge_type *end() const {
-      if (l == r) { return 0; }
-      return &G->csr_edges[r];
-    }
-
-  private:
-    const Graph *G;
-    int l, r;
-  };
-
-  bool is_prepared() { return prepared; }
-  constexpr bool is_directed() { return directed; }
-
-  Graph() : N(0), M(0), prepared(0) {}
-  Graph(int N) : N(N), M(0), prepared(0) {}
-
-  void add(int frm, int to, T cost = 1, int i = -1) {
-    assert(!prepared);
-    assert(0 <= frm && 0 <= to && to < N);
-    if (i == -1) i = M;
-    auto e = edge_type({frm, to, cost, i});
-    edges.eb(e);
-    ++M;
-  }
-
-  void build() {
-    assert(!prepared);
-    prepared = true;
-    indptr.assign(N + 1, 0);
-    for (auto &&e: edges) {
-      indptr[e.frm + 1]++;
-      if (!directed) indptr[e.to + 1]++;
-    }
-    for (int v = 0; v < N; ++v) { indptr[v + 1] += indptr[v]; }
-    auto counter = indptr;
-    csr_edges.resize(indptr.back() + 1);
-    for (auto &&e: edges) {
-      csr_edges[counter[e.frm]++] = e;
-      if (!directed)
-        csr_edges[counter[e.to]++] = edge_type({e.to, e.frm, e.cost, e.id});
-    }
-  }
-
-  OutgoingEdges operator[](int v) const {
-    assert(prepared);
-    return {this, indptr[v], indptr[v + 1]};
-  }
-};
-
-template <typename Graph>
-struct HLD {
-  Graph &G;
-  using Graph_type = Graph;
-  using WT = typename Graph::cost_type;
-  int N;
-  vector<int> LID, RID, head, V, parent, root;
-  vc<int> depth;
-  vc<WT> depth_weighted;
-  vector<bool> in_tree;
-
-  HLD(Graph &G, int r = -1)
-      : G(G),
-        N(G.N),
-        LID(G.N),
-        RID(G.N),
-        head(G.N, r),
-        V(G.N),
-        parent(G.N, -1),
-        root(G.N, -1),
-        depth(G.N, -1),
-        depth_weighted(G.N, 0),
-        in_tree(G.M, 0) {
-    assert(G.is_prepared());
-    int t1 = 0;
-    if (r != -1) {
-      dfs_sz(r, -1);
-      dfs_hld(r, t1);
-    } else {
-      for (int r = 0; r < N; ++r) {
-        if (parent[r] == -1) {
-          head[r] = r;
-          dfs_sz(r, -1);
-          dfs_hld(r, t1);
-        }
-      }
-    }
-    for (auto &&v: V) root[v] = (parent[v] == -1 ? v : root[parent[v]]);
-  }
-
-  void dfs_sz(int v, int p) {
-    auto &sz = RID;
-    parent[v] = p;
-    depth[v] = (p == -1 ? 0 : depth[p] + 1);
-    sz[v] = 1;
-    int l = G.indptr[v], r = G.indptr[v + 1];
-    auto &csr = G.csr_edges;
-    // 使う辺があれば先頭にする
-    for (int i = r - 2; i >= l; --i) {
-      if (depth[csr[i + 1].to] == -1) swap(csr[i], csr[i + 1]);
-    }
-    int hld_sz = 0;
-    for (int i = l; i < r; ++i) {
-      auto e = csr[i];
-      if (depth[e.to] != -1) continue;
-      in_tree[e.id] = 1;
-      depth_weighted[e.to] = depth_weighted[v] + e.cost;
-      dfs_sz(e.to, v);
-      sz[v] += sz[e.to];
-      if (chmax(hld_sz, sz[e.to]) && l < i) { swap(csr[l], csr[i]); }
-    }
-  }
-
-  void dfs_hld(int v, int &times) {
-    LID[v] = times++;
-    RID[v] += LID[v];
-    V[LID[v]] = v;
-    bool heavy = true;
-    for (auto &&e: G[v]) {
-      if (!in_tree[e.id] || depth[e.to] <= depth[v]) continue;
-      head[e.to] = (heavy ? head[v] : e.to);
-      heavy = false;
-      dfs_hld(e.to, times);
-    }
-  }
-
-  int e_to_v(int eid) {
-    auto e = G.edges[eid];
-    return (parent[e.frm] == e.to ? e.frm : e.to);
-  }
-
-  int ELID(int v) { return 2 * LID[v] - depth[v]; }
-  int ERID(int v) { return 2 * RID[v] - depth[v] - 1; }
-
-  /* k: 0-indexed */
-  int LA(int v, int k) {
-    assert(k <= depth[v]);
-    while (1) {
-      int u = head[v];
-      if (LID[v] - k >= LID[u]) return V[LID[v] - k];
-      k -= LID[v] - LID[u] + 1;
-      v = parent[u];
-    }
-  }
-
-  int LCA(int u, int v) {
-    for (;; v = parent[head[v]]) {
-      if (LID[u] > LID[v]) swap(u, v);
-      if (head[u] == head[v]) return u;
-    }
-  }
-
-  int lca(int u, int v) { return LCA(u, v); }
-  int la(int u, int v) { return LA(u, v); }
-
-  int subtree_size(int v) { return RID[v] - LID[v]; }
-
-  int dist(int a, int b) {
-    int c = LCA(a, b);
-    return depth[a] + depth[b] - 2 * depth[c];
-  }
-
-  WT dist(int a, int b, bool weighted) {
-    assert(weighted);
-    int c = LCA(a, b);
-    return depth_weighted[a] + depth_weighted[b] - 2 * depth_weighted[c];
-  }
-
-  bool in_subtree(int a, int b) { return LID[b] <= LID[a] && LID[a] < RID[b]; }
-
-  int jump(int a, int b, int k = 1) {
-    if (k == 1) {
-      if (a == b) return -1;
-      return (in_subtree(b, a) ? LA(b, depth[b] - depth[a] - 1) : parent[a]);
-    }
-    int c = LCA(a, b);
-    int d_ac = depth[a] - depth[c];
-    int d_bc = depth[b] - depth[c];
-    if (k > d_ac + d_bc) return -1;
-    if (k <= d_ac) return LA(a, k);
-    return LA(b, d_ac + d_bc - k);
-  }
-
-  vc<int> collect_child(int v) {
-    vc<int> res;
-    for (auto &&e: G[v])
-      if (e.to != parent[v]) res.eb(e.to);
-    return res;
-  }
-
-  vc<pair<int, int>> get_path_decomposition(int u, int v, bool edge) {
-    // [始点, 終点] の"閉"区間列。
-    vc<pair<int, int>> up, down;
-    while (1) {
-      if (head[u] == head[v]) break;
-      if (LID[u] < LID[v]) {
-        down.eb(LID[head[v]], LID[v]);
-        v = parent[head[v]];
-      } else {
-        up.eb(LID[u], LID[head[u]]);
-        u = parent[head[u]];
-      }
-    }
-    if (LID[u] < LID[v]) down.eb(LID[u] + edge, LID[v]);
-    elif (LID[v] + edge <= LID[u]) up.eb(LID[u], LID[v] + edge);
-    reverse(all(down));
-    up.insert(up.end(), all(down));
-    return up;
-  }
-};
-
-void solve() {
-  int N, Q;
-  scanf("%d %d", &N, &Q);
-  Graph<int, 0> G(N);
-  FOR(N - 1) {
-    int a, b;
-    scanf("%d %d", &a, &b);
-    G.add(a, b);
-  }
-  G.build();
-
-  HLD<decltype(G)> hld(G);
-  FOR(Q) {
-    int s, t, i;
-    scanf("%d %d %d", &s, &t, &i);
-    printf("%d\n", hld.jump(s, t, i));
-  }
-}
-
-signed main() {
-  ll T = 1;
-  // LL(T);
-  FOR(T) solve();
+#include "tree.h"
 
-  return 0;
+using namespace std;
+using namespace library_checker;
+
+int main() {
+    int n, q;
+    scanf("%d %d", &n, &q);
+    vector<pair<int, int>> edges(n - 1);
+    for (auto& [a, b] : edges) {
+        scanf("%d %d", &a, &b);
+    }
+    TreeQuery tree(n, edges, 0);
+    for (int i = 0; i < q; i++) {
+        int s, t, k;
+        scanf("%d %d %d", &s, &t, &k);
+        printf("%d\n", tree.jump(s, t, k));
+    }
+    return 0;
 }